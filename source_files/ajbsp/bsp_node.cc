@@ -18,10 +18,14 @@
 //
 //------------------------------------------------------------------------
 
+#include <atomic>
+#include <vector>
+
 #include "HandmadeMath.h"
 #include "bsp_local.h"
 #include "bsp_utility.h"
 #include "bsp_wad.h"
+#include "epi_thread.h"
 
 #define AJBSP_DEBUG_PICKNODE 0
 #define AJBSP_DEBUG_SPLIT    0
@@ -34,6 +38,9 @@
 static constexpr uint8_t kPreciousCostMultiplier = 100;
 static constexpr uint8_t kSegFastModeThreshold   = 200;
 
+// fewer partition candidates than this are evaluated serially
+static constexpr uint8_t kParallelPickMinimumSegs = 32;
+
 //
 // To be able to divide the nodes down, this routine must decide which
 // is the best Seg to use as a nodeline. It does this by selecting the
@@ -654,6 +661,121 @@ bool PickNodeWorker(QuadTree *part_list, QuadTree *tree, Seg **best, double *bes
     return true;
 }
 
+//
+// Parallel version of PickNodeWorker.
+//
+// The candidates are gathered in the order PickNodeWorker visits them
+// and split into contiguous ranges.  Each job keeps its own best seg,
+// while a shared cost bound lets every job prune against the best
+// found anywhere so far.  Pruning only rejects segs costing strictly
+// more than some real candidate, and the ranges are merged in order
+// with a strict comparison, so the result is the lowest cost seg
+// which comes first -- exactly the one the serial loop picks.
+//
+
+class PickNodeJob
+{
+  public:
+    int first_;
+    int last_;
+
+    Seg   *best_;
+    double best_cost_;
+};
+
+class PickNodeJobs
+{
+  public:
+    QuadTree *tree_;
+
+    std::vector<Seg *>       candidates_;
+    std::vector<PickNodeJob> jobs_;
+
+    std::atomic<double> shared_cost_;
+};
+
+static void CollectPartitionCandidates(QuadTree *part_list, std::vector<Seg *> &candidates)
+{
+    for (Seg *part = part_list->list_; part; part = part->next_)
+    {
+        /* ignore minisegs as partition candidates */
+        if (part->linedef_ != nullptr)
+            candidates.push_back(part);
+    }
+
+    for (int c = 0; c < 2; c++)
+    {
+        if (part_list->subs_[c] != nullptr && !part_list->subs_[c]->Empty())
+            CollectPartitionCandidates(part_list->subs_[c], candidates);
+    }
+}
+
+static void PickNodeJobRun(int index, void *userdata)
+{
+    PickNodeJobs *all = (PickNodeJobs *)userdata;
+    PickNodeJob  &job = all->jobs_[index];
+
+    job.best_      = nullptr;
+    job.best_cost_ = 1.0e99;
+
+    for (int i = job.first_; i < job.last_; i++)
+    {
+        Seg *part = all->candidates_[i];
+
+        double bound = HMM_MIN(job.best_cost_, all->shared_cost_.load(std::memory_order_relaxed));
+
+        double cost = EvalPartition(all->tree_, part, bound);
+
+        if (cost < 0 || cost >= job.best_cost_)
+            continue;
+
+        job.best_      = part;
+        job.best_cost_ = cost;
+
+        double shared = all->shared_cost_.load(std::memory_order_relaxed);
+
+        while (cost < shared && !all->shared_cost_.compare_exchange_weak(shared, cost, std::memory_order_relaxed))
+        {
+        }
+    }
+}
+
+static Seg *PickNodeParallel(QuadTree *tree, std::vector<Seg *> &candidates)
+{
+    PickNodeJobs all;
+
+    all.tree_ = tree;
+    all.candidates_.swap(candidates);
+    all.shared_cost_.store(1.0e99, std::memory_order_relaxed);
+
+    int total = (int)all.candidates_.size();
+    int count = HMM_MIN((epi::ThreadPoolWorkers() + 1) * 4, total / (kParallelPickMinimumSegs / 2));
+
+    all.jobs_.resize(count);
+
+    for (int j = 0; j < count; j++)
+    {
+        all.jobs_[j].first_ = (int)((int64_t)total * j / count);
+        all.jobs_[j].last_  = (int)((int64_t)total * (j + 1) / count);
+    }
+
+    epi::ParallelFor(count, PickNodeJobRun, &all);
+
+    Seg   *best      = nullptr;
+    double best_cost = 1.0e99;
+
+    for (const PickNodeJob &job : all.jobs_)
+    {
+        if (job.best_ != nullptr && job.best_cost_ < best_cost)
+        {
+            best      = job.best_;
+            best_cost = job.best_cost_;
+        }
+    }
+
+    return best;
+}
+
 //
 // Find the best seg in the seg_list to use as a partition line.
 //
@@ -689,6 +811,16 @@ static Seg *PickNode(QuadTree *tree)
         }
     }
 
+    if (epi::ThreadPoolWorkers() > 0)
+    {
+        std::vector<Seg *> candidates;
+
+        CollectPartitionCandidates(tree, candidates);
+
+        if ((int)candidates.size() >= kParallelPickMinimumSegs)
+            return PickNodeParallel(tree, candidates);
+    }
+
     if (!PickNodeWorker(tree, tree, &best, &best_cost))
     {
         /* hack here : BuildNodes will detect the cancellation */
@@ -349,6 +349,7 @@ void DDFAttackInit(void)
         atk = nullptr;
     }
     atkdefs.clear();
+    atkdefs.InvalidateIndex();
 }
 
 void DDFAttackCleanUp(void)
@@ -602,15 +603,23 @@ AttackDefinition *AttackDefinitionContainer::Lookup(const char *refname)
     if (!refname || !refname[0])
         return nullptr;
 
-    for (std::vector<AttackDefinition *>::iterator iter = begin(), iter_end = end(); iter != iter_end; iter++)
-    {
-        AttackDefinition *atk = *iter;
-        if (DDFCompareName(atk->name_.c_str(), refname) == 0)
-            return atk;
-    }
+    int idx = name_index_.FindFirst(*this, refname);
+
+    if (idx >= 0)
+        return (*this)[idx];
 
     return nullptr;
 }
 
+//
+// AttackDefinitionContainer::InvalidateIndex()
+//
+// Must be called when entries are renamed or reordered in place.
+//
+void AttackDefinitionContainer::InvalidateIndex()
+{
+    name_index_.Invalidate();
+}
+
 //--- editor settings ---
 // vi:ts=4:sw=4:noexpandtab
@@ -18,14 +18,20 @@
 
 #pragma once
 
+#include "ddf_index.h"
+
 class AttackDefinitionContainer : public std::vector<AttackDefinition *>
 {
   public:
     AttackDefinitionContainer();
     ~AttackDefinitionContainer();
 
+  private:
+    DDFNameIndex<AttackDefinition> name_index_;
+
   public:
     AttackDefinition *Lookup(const char *refname);
+    void              InvalidateIndex();
 };
 
 extern AttackDefinitionContainer atkdefs; // -ACB- 2004/06/09 Implemented
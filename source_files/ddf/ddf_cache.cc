@@ -0,0 +1,430 @@
+//----------------------------------------------------------------------------
+//  EDGE Data Definition Files Code (Binary Cache)
+//----------------------------------------------------------------------------
+//
+//  Copyright (c) 2024 The EDGE Team.
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation; either version 3
+//  of the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//----------------------------------------------------------------------------
+//
+//  While the DDF text is being read, every call the reader makes into
+//  the per-type parsers (start entry, field, finish entry, #CLEARALL)
+//  is recorded, with #DEFINEs already substituted.  The recording is
+//  saved in the cache directory, keyed by an MD5 of all the DDF inputs
+//  and the engine version.  On the next launch with the same inputs
+//  the calls are replayed straight from the cache, skipping all of the
+//  character-level tokenizing.
+//
+//  Since the per-type parsers still run, references between the
+//  containers are resolved exactly as they are for the text, and
+//  their warnings are given again.  Warnings from the tokenizer are
+//  recorded along with the calls and replayed in their place.
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ddf_local.h"
+#include "ddf_style.h"
+#include "epi.h"
+#include "epi_filesystem.h"
+#include "epi_md5.h"
+#include "epi_str_util.h"
+
+static constexpr const char *kDDFCacheMagic = "EDGEDDFC";
+
+// bump this when the tokenizer changes what it hands to the parsers
+static constexpr uint32_t kDDFCacheVersion = 2;
+
+class DDFCacheRecord
+{
+  public:
+    uint8_t event_;
+
+    int  line_;
+    int  index_;
+    bool is_last_;
+
+    std::string text_;
+    std::string contents_;
+};
+
+enum DDFCacheMode
+{
+    kDDFCacheModeOff = 0,
+    kDDFCacheModeRecording,
+    kDDFCacheModeReplaying
+};
+
+static std::string cache_filename;
+static std::string cache_version;
+
+static DDFCacheMode cache_mode = kDDFCacheModeOff;
+static std::string  cache_key;
+
+// one list of records per DDFMainReadFile() call
+static std::vector<std::vector<DDFCacheRecord>> cache_files;
+static size_t                                   cache_replay_file = 0;
+
+void DDFSetCacheFile(const std::string &filename, const std::string &version)
+{
+    cache_filename = filename;
+    cache_version  = version;
+}
+
+/* ---- key ---- */
+
+static std::string DDFCacheComputeKey(const std::vector<DDFFile> &files)
+{
+    std::string all = epi::StringFormat("%s %u %s\n", kDDFCacheMagic, kDDFCacheVersion, cache_version.c_str());
+
+    for (const DDFFile &it : files)
+    {
+        // RTS scripts have their own parser and are not cached
+        if (it.type == kDDFTypeRadScript)
+            continue;
+
+        epi::MD5Hash file_md5((const uint8_t *)it.data.data(), (unsigned int)it.data.size());
+
+        all += epi::StringFormat("%d %s\n", (int)it.type, file_md5.ToString().c_str());
+    }
+
+    epi::MD5Hash all_md5((const uint8_t *)all.data(), (unsigned int)all.size());
+
+    return all_md5.ToString();
+}
+
+/* ---- reading ---- */
+
+class DDFCacheReader
+{
+  public:
+    const uint8_t *pos_;
+    const uint8_t *end_;
+
+    bool failed_;
+
+  public:
+    DDFCacheReader(const uint8_t *data, int length) : pos_(data), end_(data + length), failed_(false)
+    {
+    }
+
+    ~DDFCacheReader()
+    {
+    }
+
+    uint8_t U8()
+    {
+        if (end_ - pos_ < 1)
+        {
+            failed_ = true;
+            return 0;
+        }
+
+        return *pos_++;
+    }
+
+    uint32_t U32()
+    {
+        if (end_ - pos_ < 4)
+        {
+            failed_ = true;
+            return 0;
+        }
+
+        uint32_t value = pos_[0] | (pos_[1] << 8) | (pos_[2] << 16) | ((uint32_t)pos_[3] << 24);
+
+        pos_ += 4;
+
+        return value;
+    }
+
+    std::string String()
+    {
+        uint32_t length = U32();
+
+        if (failed_ || (uint32_t)(end_ - pos_) < length)
+        {
+            failed_ = true;
+            return std::string();
+        }
+
+        std::string result((const char *)pos_, length);
+
+        pos_ += length;
+
+        return result;
+    }
+};
+
+static bool DDFCacheParse(DDFCacheReader &reader)
+{
+    size_t magic_len = strlen(kDDFCacheMagic);
+
+    if ((size_t)(reader.end_ - reader.pos_) < magic_len || memcmp(reader.pos_, kDDFCacheMagic, magic_len) != 0)
+        return false;
+
+    reader.pos_ += magic_len;
+
+    if (reader.U32() != kDDFCacheVersion)
+        return false;
+
+    if (reader.String() != cache_version || reader.String() != cache_key)
+        return false;
+
+    uint32_t total_files = reader.U32();
+
+    for (uint32_t f = 0; f < total_files && !reader.failed_; f++)
+    {
+        uint32_t total_records = reader.U32();
+
+        // catch a corrupt count before allocating for it
+        if (total_records > (uint32_t)(reader.end_ - reader.pos_))
+            return false;
+
+        cache_files.push_back(std::vector<DDFCacheRecord>(total_records));
+
+        for (DDFCacheRecord &rec : cache_files.back())
+        {
+            rec.event_    = reader.U8();
+            rec.line_     = (int)reader.U32();
+            rec.index_    = (int)reader.U32();
+            rec.is_last_  = reader.U8() != 0;
+            rec.text_     = reader.String();
+            rec.contents_ = reader.String();
+
+            if (rec.event_ > kDDFCacheEventWarning)
+                return false;
+        }
+    }
+
+    return !reader.failed_ && reader.pos_ == reader.end_;
+}
+
+static bool DDFCacheLoad(void)
+{
+    epi::File *file = epi::FileOpen(cache_filename, epi::kFileAccessRead | epi::kFileAccessBinary);
+    if (file == nullptr)
+        return false;
+
+    int      length = file->GetLength();
+    uint8_t *data   = file->LoadIntoMemory();
+
+    delete file;
+
+    if (data == nullptr)
+        return false;
+
+    DDFCacheReader reader(data, length);
+
+    bool ok = DDFCacheParse(reader);
+
+    delete[] data;
+
+    if (!ok)
+        cache_files.clear();
+
+    return ok;
+}
+
+/* ---- writing ---- */
+
+static void PutU8(std::string &out, uint8_t value)
+{
+    out.push_back((char)value);
+}
+
+static void PutU32(std::string &out, uint32_t value)
+{
+    out.push_back((char)(value & 0xFF));
+    out.push_back((char)((value >> 8) & 0xFF));
+    out.push_back((char)((value >> 16) & 0xFF));
+    out.push_back((char)((value >> 24) & 0xFF));
+}
+
+static void PutString(std::string &out, const std::string &str)
+{
+    PutU32(out, (uint32_t)str.size());
+    out += str;
+}
+
+static void DDFCacheSave(void)
+{
+    std::string out(kDDFCacheMagic);
+
+    PutU32(out, kDDFCacheVersion);
+    PutString(out, cache_version);
+    PutString(out, cache_key);
+
+    PutU32(out, (uint32_t)cache_files.size());
+
+    for (const std::vector<DDFCacheRecord> &records : cache_files)
+    {
+        PutU32(out, (uint32_t)records.size());
+
+        for (const DDFCacheRecord &rec : records)
+        {
+            PutU8(out, rec.event_);
+            PutU32(out, (uint32_t)rec.line_);
+            PutU32(out, (uint32_t)rec.index_);
+            PutU8(out, rec.is_last_ ? 1 : 0);
+            PutString(out, rec.text_);
+            PutString(out, rec.contents_);
+        }
+    }
+
+    FILE *fp = epi::FileOpenRaw(cache_filename, epi::kFileAccessWrite | epi::kFileAccessBinary);
+    if (fp == nullptr)
+    {
+        LogWarning("Unable to write DDF cache: %s\n", cache_filename.c_str());
+        return;
+    }
+
+    bool ok = fwrite(out.data(), out.size(), 1, fp) == 1;
+
+    fclose(fp);
+
+    // never leave a truncated cache behind
+    if (!ok)
+    {
+        LogWarning("Unable to write DDF cache: %s\n", cache_filename.c_str());
+        epi::FileDelete(cache_filename);
+    }
+}
+
+/* ---- recording and replaying ---- */
+
+void DDFCacheBegin(const std::vector<DDFFile> &files)
+{
+    cache_files.clear();
+    cache_replay_file = 0;
+
+    if (cache_filename.empty())
+    {
+        cache_mode = kDDFCacheModeOff;
+        return;
+    }
+
+    cache_key = DDFCacheComputeKey(files);
+
+    if (DDFCacheLoad())
+    {
+        LogPrint("DDF: using cached definitions from %s\n", cache_filename.c_str());
+        cache_mode = kDDFCacheModeReplaying;
+    }
+    else
+    {
+        cache_mode = kDDFCacheModeRecording;
+    }
+}
+
+void DDFCacheFinish(void)
+{
+    if (cache_mode == kDDFCacheModeRecording)
+        DDFCacheSave();
+
+    cache_mode = kDDFCacheModeOff;
+
+    cache_files.clear();
+    cache_files.shrink_to_fit();
+}
+
+void DDFCacheRecordFile(void)
+{
+    if (cache_mode == kDDFCacheModeRecording)
+        cache_files.push_back(std::vector<DDFCacheRecord>());
+}
+
+void DDFCacheRecordEvent(DDFCacheEvent event, const char *text, const char *contents, int index, bool is_last)
+{
+    if (cache_mode != kDDFCacheModeRecording)
+        return;
+
+    EPI_ASSERT(!cache_files.empty());
+
+    cache_files.back().push_back(DDFCacheRecord());
+
+    DDFCacheRecord &rec = cache_files.back().back();
+
+    rec.event_   = event;
+    rec.line_    = cur_ddf_line_num;
+    rec.index_   = index;
+    rec.is_last_ = is_last;
+
+    if (text)
+        rec.text_ = text;
+    if (contents)
+        rec.contents_ = contents;
+}
+
+bool DDFCacheReplayFile(DDFReadInfo *readinfo)
+{
+    if (cache_mode != kDDFCacheModeReplaying || cache_replay_file >= cache_files.size())
+        return false;
+
+    const std::vector<DDFCacheRecord> &records = cache_files[cache_replay_file++];
+
+    cur_ddf_filename = std::string(readinfo->lumpname);
+    cur_ddf_entryname.clear();
+    cur_ddf_linedata = std::string_view();
+
+    for (const DDFCacheRecord &rec : records)
+    {
+        cur_ddf_line_num = rec.line_;
+
+        switch (rec.event_)
+        {
+        case kDDFCacheEventStartEntry:
+            cur_ddf_entryname = epi::StringFormat("[%s]", rec.text_.c_str());
+
+            if (rec.text_.compare(0, 2, "++") == 0)
+                (*readinfo->start_entry)(rec.text_.c_str() + 2, true);
+            else
+                (*readinfo->start_entry)(rec.text_.c_str(), false);
+            break;
+
+        case kDDFCacheEventField:
+            (*readinfo->parse_field)(rec.text_.c_str(), rec.contents_.c_str(), rec.index_, rec.is_last_);
+            break;
+
+        case kDDFCacheEventFinishEntry:
+            (*readinfo->finish_entry)();
+            cur_ddf_entryname.clear();
+            break;
+
+        case kDDFCacheEventClearAll:
+            (*readinfo->clear_all)();
+            break;
+
+        case kDDFCacheEventNoPatchMenus:
+            styledefs.patch_menus_allowed_ = false;
+            break;
+
+        case kDDFCacheEventWarning:
+            cur_ddf_linedata = rec.contents_;
+            DDFWarnError("%s", rec.text_.c_str());
+            cur_ddf_linedata = std::string_view();
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    cur_ddf_entryname.clear();
+    cur_ddf_filename.clear();
+
+    return true;
+}
+
+//--- editor settings ---
+// vi:ts=4:sw=4:noexpandtab
@@ -134,6 +134,7 @@ static void ColmapFinishEntry(void)
             else
                 ++iter;
         }
+        colormaps.InvalidateIndex();
     }
 }
 
@@ -165,6 +166,7 @@ void DDFColmapInit(void)
         cmap = nullptr;
     }
     colormaps.clear();
+    colormaps.InvalidateIndex();
 }
 
 void DDFColmapCleanUp(void)
@@ -295,16 +297,24 @@ Colormap *ColormapContainer::Lookup(const char *refname)
     if (!refname || !refname[0])
         return nullptr;
 
-    for (std::vector<Colormap *>::iterator iter = begin(), iter_end = end(); iter != iter_end; iter++)
-    {
-        Colormap *cmap = *iter;
-        if (DDFCompareName(cmap->name_.c_str(), refname) == 0)
-            return cmap;
-    }
+    int idx = name_index_.FindFirst(*this, refname);
+
+    if (idx >= 0)
+        return (*this)[idx];
 
     return nullptr;
 }
 
+//
+// ColormapContainer::InvalidateIndex()
+//
+// Must be called when entries are renamed or removed in place.
+//
+void ColormapContainer::InvalidateIndex()
+{
+    name_index_.Invalidate();
+}
+
 //----------------------------------------------------------------------------
 
 //
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "ddf_index.h"
 #include "ddf_types.h"
 
 enum ColorSpecial
@@ -86,8 +87,12 @@ class ColormapContainer : public std::vector<Colormap *>
     ColormapContainer();
     ~ColormapContainer();
 
+  private:
+    DDFNameIndex<Colormap> name_index_;
+
   public:
     Colormap *Lookup(const char *refname);
+    void      InvalidateIndex();
 };
 
 extern ColormapContainer colormaps; // -ACB- 2004/06/10 Implemented
@@ -201,6 +201,7 @@ void DDFImageInit(void)
         img = nullptr;
     }
     imagedefs.clear();
+    imagedefs.InvalidateIndex();
 }
 
 void DDFImageCleanUp(void)
@@ -463,11 +464,17 @@ ImageDefinition *ImageDefinitionContainer::Lookup(const char *refname, ImageName
     if (!refname || !refname[0])
         return nullptr;
 
-    for (std::vector<ImageDefinition *>::iterator iter = begin(), iter_end = end(); iter != iter_end; iter++)
+    int idx = name_index_.FindFirst(*this, refname);
+
+    if (idx < 0)
+        return nullptr;
+
+    // the same name may be used in several namespaces
+    for (; idx < (int)size(); idx++)
     {
-        ImageDefinition *g = *iter;
+        ImageDefinition *g = at(idx);
 
-        if (DDFCompareName(g->name_.c_str(), refname) == 0 && g->belong_ == belong)
+        if (g->belong_ == belong && DDFCompareName(g->name_.c_str(), refname) == 0)
             return g;
     }
 
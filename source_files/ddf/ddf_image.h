@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "ddf_index.h"
 #include "ddf_types.h"
 
 enum ImageNamespace
@@ -146,11 +147,18 @@ class ImageDefinitionContainer : public std::vector<ImageDefinition *>
     }
 
   private:
+    DDFNameIndex<ImageDefinition> name_index_;
+
     void CleanupObject(void *obj);
 
   public:
     // Search Functions
     ImageDefinition *Lookup(const char *refname, ImageNamespace belong);
+
+    void InvalidateIndex()
+    {
+        name_index_.Invalidate();
+    }
 };
 
 extern ImageDefinitionContainer imagedefs;
@@ -0,0 +1,197 @@
+//----------------------------------------------------------------------------
+//  EDGE Data Definition File Code (Container Index)
+//----------------------------------------------------------------------------
+//
+//  Copyright (c) 2024 The EDGE Team.
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation; either version 3
+//  of the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//----------------------------------------------------------------------------
+//
+//  Hashed name and number lookup for the DDF containers.
+//
+//  The containers are plain vectors which the parsers append to, so
+//  the index follows them lazily: entries added at the end are picked
+//  up by the next lookup, and a shrunk container is re-indexed from
+//  scratch.  Anything else (entries reordered or renumbered in place)
+//  must call Invalidate().  Every hit is checked against the entry
+//  itself, so a stale index costs a rebuild, never a wrong answer.
+//
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+int DDFCompareName(const char *A, const char *B);
+
+// the form of a name which DDFCompareName() considers equal
+std::string DDFNameKey(const char *name);
+
+// indexes the `name_' field of each entry
+template <typename T> class DDFNameIndex
+{
+  private:
+    class Positions
+    {
+      public:
+        int first_;
+        int last_;
+    };
+
+    std::unordered_map<std::string, Positions> names_;
+
+    size_t indexed_;
+
+  public:
+    DDFNameIndex() : names_(), indexed_(0)
+    {
+    }
+
+    ~DDFNameIndex()
+    {
+    }
+
+    void Invalidate()
+    {
+        names_.clear();
+        indexed_ = 0;
+    }
+
+    // returns position of the first/last entry with the name, or -1
+    int FindFirst(const std::vector<T *> &list, const char *name)
+    {
+        return Find(list, name, false);
+    }
+    int FindLast(const std::vector<T *> &list, const char *name)
+    {
+        return Find(list, name, true);
+    }
+
+  private:
+    void Update(const std::vector<T *> &list)
+    {
+        if (indexed_ > list.size())
+            Invalidate();
+
+        for (; indexed_ < list.size(); indexed_++)
+        {
+            std::string key = DDFNameKey(list[indexed_]->name_.c_str());
+
+            auto find = names_.find(key);
+
+            if (find == names_.end())
+                names_[key] = {(int)indexed_, (int)indexed_};
+            else
+                find->second.last_ = (int)indexed_;
+        }
+    }
+
+    int Find(const std::vector<T *> &list, const char *name, bool last)
+    {
+        for (int attempt = 0; attempt < 2; attempt++)
+        {
+            Update(list);
+
+            auto find = names_.find(DDFNameKey(name));
+
+            if (find == names_.end())
+                return -1;
+
+            int pos = last ? find->second.last_ : find->second.first_;
+
+            if (pos < (int)list.size() && DDFCompareName(list[pos]->name_.c_str(), name) == 0)
+                return pos;
+
+            Invalidate();
+        }
+
+        return -1;
+    }
+};
+
+// the numbers DDFNumberIndex looks entries up by: Add() enters every
+// number the entry answers to, Has() checks the entry still does
+template <typename T> class DDFNumberField
+{
+  public:
+    static void Add(std::unordered_map<int, int> &numbers, const T *entry, int pos)
+    {
+        numbers[entry->number_] = pos;
+    }
+
+    static bool Has(const T *entry, int number)
+    {
+        return entry->number_ == number;
+    }
+};
+
+// indexes the `number_' field of each entry (or whatever Keys
+// provides), the last one wins
+template <typename T, typename Keys = DDFNumberField<T>> class DDFNumberIndex
+{
+  private:
+    std::unordered_map<int, int> numbers_;
+
+    size_t indexed_;
+
+  public:
+    DDFNumberIndex() : numbers_(), indexed_(0)
+    {
+    }
+
+    ~DDFNumberIndex()
+    {
+    }
+
+    void Invalidate()
+    {
+        numbers_.clear();
+        indexed_ = 0;
+    }
+
+    // returns position of the last entry with the number, or -1
+    int FindLast(const std::vector<T *> &list, int number)
+    {
+        for (int attempt = 0; attempt < 2; attempt++)
+        {
+            Update(list);
+
+            auto find = numbers_.find(number);
+
+            if (find == numbers_.end())
+                return -1;
+
+            int pos = find->second;
+
+            if (pos < (int)list.size() && Keys::Has(list[pos], number))
+                return pos;
+
+            Invalidate();
+        }
+
+        return -1;
+    }
+
+  private:
+    void Update(const std::vector<T *> &list)
+    {
+        if (indexed_ > list.size())
+            Invalidate();
+
+        for (; indexed_ < list.size(); indexed_++)
+            Keys::Add(numbers_, list[indexed_], (int)indexed_);
+    }
+};
+
+//--- editor settings ---
+// vi:ts=4:sw=4:noexpandtab
@@ -1700,25 +1700,10 @@ LineType *LineTypeContainer::Lookup(const int id)
     if (id == 0)
         return default_linetype;
 
-    int slot = (((id) + kLookupCacheSize) % kLookupCacheSize);
+    int idx = number_index_.FindLast(*this, id);
 
-    // check the cache
-    if (lookup_cache_[slot] && lookup_cache_[slot]->number_ == id)
-    {
-        return lookup_cache_[slot];
-    }
-
-    for (auto iter = rbegin(); iter != rend(); iter++)
-    {
-        LineType *l = *iter;
-
-        if (l->number_ == id)
-        {
-            // update the cache
-            lookup_cache_[slot] = l;
-            return l;
-        }
-    }
+    if (idx >= 0)
+        return (*this)[idx];
 
     return nullptr;
 }
@@ -1726,7 +1711,7 @@ LineType *LineTypeContainer::Lookup(const int id)
 //
 // LineTypeContainer::Reset()
 //
-// Clears down both the data and the cache
+// Clears down both the data and the index
 //
 void LineTypeContainer::Reset()
 {
@@ -1737,7 +1722,7 @@ void LineTypeContainer::Reset()
         line = nullptr;
     }
     clear();
-    memset(lookup_cache_, 0, sizeof(LineType *) * kLookupCacheSize);
+    number_index_.Invalidate();
 }
 
 //--- editor settings ---
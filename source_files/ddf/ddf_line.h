@@ -19,6 +19,7 @@
 #pragma once
 
 #include "ddf_colormap.h"
+#include "ddf_index.h"
 #include "ddf_types.h"
 
 constexpr float kFloatUnused = 3.18081979f;
@@ -745,7 +746,7 @@ class LineTypeContainer : public std::vector<LineType *>
     ~LineTypeContainer();
 
   private:
-    LineType *lookup_cache_[kLookupCacheSize];
+    DDFNumberIndex<LineType> number_index_;
 
   public:
     LineType *Lookup(int num);
@@ -881,7 +882,7 @@ class SectorTypeContainer : public std::vector<SectorType *>
     ~SectorTypeContainer();
 
   private:
-    SectorType *lookup_cache_[kLookupCacheSize];
+    DDFNumberIndex<SectorType> number_index_;
 
   public:
     SectorType *Lookup(int num);
@@ -20,6 +20,8 @@
 
 #include <stddef.h>
 
+#include <string_view>
+
 #include "ddf_main.h"
 #include "ddf_states.h"
 #include "ddf_types.h"
@@ -170,10 +172,28 @@ struct DDFStateStarter
 // DDFMAIN Code (Reading all files, main init & generic functions).
 void DDFMainReadFile(DDFReadInfo *readinfo, const std::string &data);
 
-extern int         cur_ddf_line_num;
-extern std::string cur_ddf_filename;
-extern std::string cur_ddf_entryname;
-extern std::string cur_ddf_linedata;
+// DDFCACHE Code
+enum DDFCacheEvent
+{
+    kDDFCacheEventStartEntry = 0, // entry name as written, e.g. "++IMP"
+    kDDFCacheEventField,          // command and contents
+    kDDFCacheEventFinishEntry,
+    kDDFCacheEventClearAll,
+    kDDFCacheEventNoPatchMenus,
+    kDDFCacheEventWarning         // message and line contents
+};
+
+void DDFCacheBegin(const std::vector<DDFFile> &files);
+void DDFCacheFinish(void);
+bool DDFCacheReplayFile(DDFReadInfo *readinfo);
+void DDFCacheRecordFile(void);
+void DDFCacheRecordEvent(DDFCacheEvent event, const char *text = nullptr, const char *contents = nullptr,
+                         int index = 0, bool is_last = false);
+
+extern int              cur_ddf_line_num;
+extern std::string      cur_ddf_filename;
+extern std::string      cur_ddf_entryname;
+extern std::string_view cur_ddf_linedata;
 
 #ifdef __GNUC__
 void DDFError(const char *err, ...) __attribute__((format(printf, 1, 2)));
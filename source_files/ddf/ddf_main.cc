@@ -20,6 +20,8 @@
 #include <stdarg.h>
 #include <string.h>
 
+#include <unordered_map>
+
 #include "ddf_anim.h"
 #include "ddf_colormap.h"
 #include "ddf_font.h"
@@ -29,6 +31,7 @@
 #include "ddf_switch.h"
 // EPI
 #include "epi.h"
+#include "epi_ename.h"
 #include "epi_filesystem.h"
 #include "epi_str_compare.h"
 #include "epi_str_util.h"
@@ -83,10 +86,10 @@ bool no_warnings   = false;
 //
 // -AJA- 1999/10/27: written.
 //
-int         cur_ddf_line_num;
-std::string cur_ddf_filename;
-std::string cur_ddf_entryname;
-std::string cur_ddf_linedata;
+int              cur_ddf_line_num;
+std::string      cur_ddf_filename;
+std::string      cur_ddf_entryname;
+std::string_view cur_ddf_linedata; // points into the text being read
 
 void DDFError(const char *err, ...)
 {
@@ -115,9 +118,9 @@ void DDFError(const char *err, ...)
         pos += strlen(pos);
     }
 
-    if (cur_ddf_linedata != "")
+    if (!cur_ddf_linedata.empty())
     {
-        sprintf(pos, "Line contents: %s\n", cur_ddf_linedata.c_str());
+        sprintf(pos, "Line contents: %.*s\n", (int)cur_ddf_linedata.size(), cur_ddf_linedata.data());
         pos += strlen(pos);
     }
 
@@ -157,7 +160,7 @@ void DDFWarning(const char *err, ...)
 
     if (!cur_ddf_linedata.empty())
     {
-        LogPrint("  with line contents: %s\n", cur_ddf_linedata.c_str());
+        LogPrint("  with line contents: %.*s\n", (int)cur_ddf_linedata.size(), cur_ddf_linedata.data());
     }
 }
 
@@ -187,7 +190,7 @@ void DDFDebug(const char *err, ...)
 
     if (!cur_ddf_linedata.empty())
     {
-        LogDebug("  with line contents: %s\n", cur_ddf_linedata.c_str());
+        LogDebug("  with line contents: %.*s\n", (int)cur_ddf_linedata.size(), cur_ddf_linedata.data());
     }
 }
 
@@ -491,6 +494,28 @@ void DDFGetLumpNameForFile(const char *filename, char *lumpname)
 // from the character read from the file.
 //
 
+// -ACB- 1998/08/11 Used for detecting formatting in a string
+static bool formatchar = false;
+
+//
+// Warnings from the reader itself are kept in the DDF cache, since a
+// replay skips the reader.  (The per-type parsers are replayed, so
+// their warnings come out again by themselves.)
+//
+static void DDFReaderWarning(const char *err, ...)
+{
+    va_list argptr;
+    char    buffer[1024];
+
+    va_start(argptr, err);
+    vsprintf(buffer, err, argptr);
+    va_end(argptr);
+
+    DDFCacheRecordEvent(kDDFCacheEventWarning, buffer, std::string(cur_ddf_linedata).c_str());
+
+    DDFWarnError("%s", buffer);
+}
+
 //
 // DDFMainProcessChar
 //
@@ -498,10 +523,6 @@ void DDFGetLumpNameForFile(const char *filename, char *lumpname)
 //
 static DDFReadCharReturn DDFMainProcessChar(char character, std::string &token, int status)
 {
-    // int len;
-
-    // -ACB- 1998/08/11 Used for detecting formatting in a string
-    static bool formatchar = false;
 
     // With the exception of kDDFReadStatusReadingString, whitespace is ignored.
     if (status != kDDFReadStatusReadingString)
@@ -622,7 +643,7 @@ static DDFReadCharReturn DDFMainProcessChar(char character, std::string &token,
             return kDDFReadCharReturnOK;
         }
         else if (epi::IsPrintASCII(character))
-            DDFWarnError("DDF: Illegal character '%c' found.\n", character);
+            DDFReaderWarning("DDF: Illegal character '%c' found.\n", character);
 
         break;
 
@@ -667,7 +688,7 @@ static DDFReadCharReturn DDFMainProcessChar(char character, std::string &token,
         else if (character == '\n')
         {
             cur_ddf_line_num--;
-            DDFWarnError("Unclosed string detected.\n");
+            DDFReaderWarning("Unclosed string detected.\n");
 
             cur_ddf_line_num++;
             return kDDFReadCharReturnNothing;
@@ -690,6 +711,82 @@ static DDFReadCharReturn DDFMainProcessChar(char character, std::string &token,
     return kDDFReadCharReturnNothing;
 }
 
+// Characters which DDFMainProcessChar() would simply add to the token
+// (or skip, inside a remark) for each reading status.  Runs of them are
+// handled in one go, straight from the text.  '#' and '\n' always end a
+// run, since directives are checked for at those.
+enum DDFTokenRunClass
+{
+    kDDFTokenRunNone       = 0,
+    kDDFTokenRunDefinition = (1 << 0),
+    kDDFTokenRunCommand    = (1 << 1),
+    kDDFTokenRunData       = (1 << 2),
+    kDDFTokenRunString     = (1 << 3),
+    kDDFTokenRunRemark     = (1 << 4)
+};
+
+static uint8_t token_run_classes[256];
+static bool    token_run_classes_ready = false;
+
+static void DDFMainInitTokenRuns(void)
+{
+    for (int i = 0; i < 256; i++)
+    {
+        // same (signed) value DDFMainProcessChar() is given
+        int ch = (char)i;
+
+        uint8_t run_class = kDDFTokenRunNone;
+
+        if (epi::IsAlphanumericASCII(ch) || ch == '_' || ch == ':' || ch == '+')
+            run_class |= kDDFTokenRunDefinition;
+
+        if (epi::IsAlphanumericASCII(ch) || ch == '_' || ch == '(' || ch == ')' || ch == '.')
+            run_class |= kDDFTokenRunCommand;
+
+        if (epi::IsAlphanumericASCII(ch) || ch == '_' || ch == '-' || ch == ':' || ch == '.' || ch == '[' ||
+            ch == ']' || ch == '\\' || ch == '!' || ch == '%' || ch == '+' || ch == '@' || ch == '?')
+            run_class |= kDDFTokenRunData;
+
+        if (ch != '\\' && ch != '\"' && ch != '\n' && ch != '#')
+            run_class |= kDDFTokenRunString;
+
+        if (ch != '{' && ch != '}' && ch != '\n' && ch != '#')
+            run_class |= kDDFTokenRunRemark;
+
+        token_run_classes[i] = run_class;
+    }
+
+    token_run_classes_ready = true;
+}
+
+static uint8_t DDFMainTokenRunClass(int status)
+{
+    switch (status)
+    {
+    case kDDFReadStatusReadingNewDefinition:
+        return kDDFTokenRunDefinition;
+    case kDDFReadStatusReadingCommand:
+        return kDDFTokenRunCommand;
+    case kDDFReadStatusReadingData:
+        return kDDFTokenRunData;
+    case kDDFReadStatusReadingString:
+        // the character after a backslash is not plain
+        return formatchar ? kDDFTokenRunNone : kDDFTokenRunString;
+    case kDDFReadStatusReadingRemark:
+        return kDDFTokenRunRemark;
+    default:
+        return kDDFTokenRunNone;
+    }
+}
+
+// does the text at `pos' begin with the given directive?
+static bool DDFMainMatchDirective(const char *pos, const char *end, const char *directive, size_t length)
+{
+    size_t avail = (size_t)(end - pos);
+
+    return epi::StringPrefixCaseCompareASCII(std::string_view(pos, HMM_MIN(length, avail)), directive) == 0;
+}
+
 //
 // DDFMainReadFile
 //
@@ -703,9 +800,6 @@ void DDFMainReadFile(DDFReadInfo *readinfo, const std::string &data)
     std::string token;
     std::string current_cmd;
 
-    char *name  = nullptr;
-    char *value = nullptr;
-
     int current_index = 0;
 
 #if (DDF_DEBUG_READ)
@@ -719,59 +813,70 @@ void DDFMainReadFile(DDFReadInfo *readinfo, const std::string &data)
     int  bracket_level = 0;
     bool firstgo       = true;
 
+    if (DDFCacheReplayFile(readinfo))
+        return;
+
+    DDFCacheRecordFile();
+
+    if (!token_run_classes_ready)
+        DDFMainInitTokenRuns();
+
     cur_ddf_line_num = 1;
     cur_ddf_filename = std::string(readinfo->lumpname);
     cur_ddf_entryname.clear();
 
-    // WISH: don't make this copy, parse directly from the string
-    char *memfile = new char[data.size() + 1];
-    data.copy(memfile, std::string::npos);
-    memfile[data.size()] = 0;
+    formatchar = false;
 
-    char *memfileptr = memfile;
-    int   memsize    = (int)data.size();
+    // the text is read in place, tokens are built from runs of it
+    const char *pos = data.data();
+    const char *end = pos + data.size();
 
-    // -ACB- 1998/09/12 Copy file to memory: Read until end. Speed optimisation.
-    while (memfileptr < &memfile[memsize])
+    while (pos < end)
     {
         // -KM- 1998/12/16 Added #define command to ddf files.
-        if (epi::StringPrefixCaseCompareASCII(std::string_view(memfileptr, 7), "#DEFINE") == 0)
+        if (*pos == '#' && DDFMainMatchDirective(pos, end, "#DEFINE", 7))
         {
             bool line = false;
 
-            memfileptr += 8;
-            name = memfileptr;
+            pos = HMM_MIN(pos + 8, end);
 
-            while (*memfileptr != ' ' && memfileptr < &memfile[memsize])
-                memfileptr++;
+            const char *name_start = pos;
 
-            if (memfileptr < &memfile[memsize])
-            {
-                *memfileptr++ = 0;
-                value         = memfileptr;
-            }
-            else
-            {
-                DDFError("#DEFINE '%s' as what?!\n", name);
-            }
+            while (pos < end && *pos != ' ')
+                pos++;
+
+            std::string name(name_start, pos - name_start);
+
+            if (pos >= end)
+                DDFError("#DEFINE '%s' as what?!\n", name.c_str());
+
+            const char *value_start = ++pos;
 
             // FIXME handle comments, stop at "//"
 
-            while (memfileptr < &memfile[memsize])
+            while (pos < end)
             {
-                if (*memfileptr == '\r')
-                    *memfileptr = ' ';
-                if (*memfileptr == '\\')
+                if (*pos == '\\')
                     line = true;
-                if (*memfileptr == '\n' && !line)
+                if (*pos == '\n' && !line)
                     break;
-                memfileptr++;
+                pos++;
             }
 
-            if (*memfileptr == '\n')
-                cur_ddf_line_num++;
+            std::string value(value_start, pos - value_start);
 
-            *memfileptr++ = 0;
+            for (char &ch : value)
+            {
+                if (ch == '\r')
+                    ch = ' ';
+            }
+
+            if (pos < end)
+            {
+                if (*pos == '\n')
+                    cur_ddf_line_num++;
+                pos++;
+            }
 
             DDFMainAddDefine(name, value);
 
@@ -781,19 +886,50 @@ void DDFMainReadFile(DDFReadInfo *readinfo, const std::string &data)
 
         // -AJA- 1999/10/27: Not the greatest place for it, but detect //
         //       comments here and ignore them.  Ow the pain of long
-        //       identifier names...  Ow the pain of &memfile[size] :-)
+        //       identifier names...
 
-        if (comment_level == 0 && status != kDDFReadStatusReadingString && memfileptr + 1 < &memfile[memsize] &&
-            memfileptr[0] == '/' && memfileptr[1] == '/')
+        if (comment_level == 0 && status != kDDFReadStatusReadingString && pos + 1 < end && pos[0] == '/' &&
+            pos[1] == '/')
         {
-            while (memfileptr < &memfile[memsize] && *memfileptr != '\n')
-                memfileptr++;
+            while (pos < end && *pos != '\n')
+                pos++;
 
-            if (memfileptr >= &memfile[memsize])
+            if (pos >= end)
                 break;
         }
 
-        char character = *memfileptr++;
+        // take a whole run of plain characters at once
+        uint8_t run_class = DDFMainTokenRunClass(status);
+
+        if (run_class != kDDFTokenRunNone)
+        {
+            const char *run_end = pos;
+
+            while (run_end < end && (token_run_classes[(uint8_t)*run_end] & run_class))
+                run_end++;
+
+            if (run_end > pos)
+            {
+                if (status == kDDFReadStatusReadingString)
+                {
+                    token.append(pos, run_end - pos);
+                }
+                else if (status != kDDFReadStatusReadingRemark)
+                {
+                    size_t old_len = token.size();
+
+                    token.append(pos, run_end - pos);
+
+                    for (size_t i = old_len; i < token.size(); i++)
+                        token[i] = epi::ToUpperASCII(token[i]);
+                }
+
+                pos = run_end;
+                continue;
+            }
+        }
+
+        char character = *pos++;
 
         if (character == '\n')
         {
@@ -802,43 +938,45 @@ void DDFMainReadFile(DDFReadInfo *readinfo, const std::string &data)
             cur_ddf_line_num++;
 
             // -AJA- 2000/03/21: determine linedata.  Ouch.
-            for (l_len = 0;
-                 &memfileptr[l_len] < &memfile[memsize] && memfileptr[l_len] != '\n' && memfileptr[l_len] != '\r';
-                 l_len++)
+            for (l_len = 0; pos + l_len < end && pos[l_len] != '\n' && pos[l_len] != '\r'; l_len++)
             {
             }
 
-            cur_ddf_linedata = std::string(memfileptr, l_len);
+            cur_ddf_linedata = std::string_view(pos, l_len);
 
             // -AJA- 2001/05/21: handle directives (lines beginning with #).
             // This code is more hackitude -- to be fixed when the whole
             // parsing code gets the overhaul it needs.
 
-            if (epi::StringPrefixCaseCompareASCII(std::string_view(memfileptr, 9), "#CLEARALL") == 0)
+            if (DDFMainMatchDirective(pos, end, "#CLEARALL", 9))
             {
                 if (!firstgo)
                     DDFError("#CLEARALL cannot be used inside an entry !\n");
 
+                DDFCacheRecordEvent(kDDFCacheEventClearAll);
+
                 (*readinfo->clear_all)();
 
-                memfileptr += l_len;
+                pos += l_len;
                 continue;
             }
 
-            if (epi::StringPrefixCaseCompareASCII(std::string_view(memfileptr, 8), "#VERSION") == 0)
+            if (DDFMainMatchDirective(pos, end, "#VERSION", 8))
             {
                 // just ignore it
-                memfileptr += l_len;
+                pos += l_len;
                 continue;
             }
 
-            if (epi::StringPrefixCaseCompareASCII(std::string_view(memfileptr, 13), "#NOPATCHMENUS") == 0)
+            if (DDFMainMatchDirective(pos, end, "#NOPATCHMENUS", 13))
             {
                 if (epi::StringCaseCompareASCII(readinfo->lumpname, "DDFSTYLE") == 0)
                 {
+                    DDFCacheRecordEvent(kDDFCacheEventNoPatchMenus);
+
                     styledefs.patch_menus_allowed_ = false;
                 }
-                memfileptr += l_len;
+                pos += l_len;
                 continue;
             }
         }
@@ -899,9 +1037,11 @@ void DDFMainReadFile(DDFReadInfo *readinfo, const std::string &data)
             }
             else
             {
-                cur_ddf_linedata.clear();
+                cur_ddf_linedata = std::string_view();
 
                 // finish off previous entry
+                DDFCacheRecordEvent(kDDFCacheEventFinishEntry);
+
                 (*readinfo->finish_entry)();
 
                 token.clear();
@@ -915,6 +1055,8 @@ void DDFMainReadFile(DDFReadInfo *readinfo, const std::string &data)
         case kDDFReadCharReturnDefinitionStop:
             cur_ddf_entryname = epi::StringFormat("[%s]", token.c_str());
 
+            DDFCacheRecordEvent(kDDFCacheEventStartEntry, token.c_str());
+
             // -AJA- 2009/07/27: extend an existing entry
             if (token[0] == '+' && token[1] == '+')
                 (*readinfo->start_entry)(token.c_str() + 2, true);
@@ -951,10 +1093,14 @@ void DDFMainReadFile(DDFReadInfo *readinfo, const std::string &data)
                 DDFError("Unexpected comma `,'.\n");
 
             if (firstgo)
-                DDFWarnError("Command %s used outside of any entry\n", current_cmd.c_str());
+                DDFReaderWarning("Command %s used outside of any entry\n", current_cmd.c_str());
             else
             {
-                (*readinfo->parse_field)(current_cmd.c_str(), DDFMainGetDefine(token.c_str()), current_index, false);
+                const char *contents = DDFMainGetDefine(token.c_str());
+
+                DDFCacheRecordEvent(kDDFCacheEventField, current_cmd.c_str(), contents, current_index, false);
+
+                (*readinfo->parse_field)(current_cmd.c_str(), contents, current_index, false);
                 current_index++;
             }
 
@@ -978,7 +1124,13 @@ void DDFMainReadFile(DDFReadInfo *readinfo, const std::string &data)
             if (bracket_level > 0)
                 DDFError("Missing ')' bracket in ddf command.\n");
 
-            (*readinfo->parse_field)(current_cmd.c_str(), DDFMainGetDefine(token.c_str()), current_index, true);
+            {
+                const char *contents = DDFMainGetDefine(token.c_str());
+
+                DDFCacheRecordEvent(kDDFCacheEventField, current_cmd.c_str(), contents, current_index, true);
+
+                (*readinfo->parse_field)(current_cmd.c_str(), contents, current_index, true);
+            }
             current_index = 0;
 
             token.clear();
@@ -986,7 +1138,7 @@ void DDFMainReadFile(DDFReadInfo *readinfo, const std::string &data)
             break;
 
         case kDDFReadCharReturnProperty:
-            DDFWarnError("Badly formed command: Unexpected semicolon `;'\n");
+            DDFReaderWarning("Badly formed command: Unexpected semicolon `;'\n");
             break;
 
         case kDDFReadCharReturnNothing:
@@ -1010,7 +1162,7 @@ void DDFMainReadFile(DDFReadInfo *readinfo, const std::string &data)
     }
 
     current_cmd.clear();
-    cur_ddf_linedata.clear();
+    cur_ddf_linedata = std::string_view();
 
     // -AJA- 1999/10/21: check for unclosed comments
     if (comment_level > 0)
@@ -1026,13 +1178,15 @@ void DDFMainReadFile(DDFReadInfo *readinfo, const std::string &data)
         DDFError("Unclosed [] brackets detected.\n");
 
     if (status == kDDFReadStatusReadingData || status == kDDFReadStatusReadingString)
-        DDFWarnError("Unfinished DDF command on last line.\n");
+        DDFReaderWarning("Unfinished DDF command on last line.\n");
 
     // if firstgo is true, nothing was defined
     if (!firstgo)
-        (*readinfo->finish_entry)();
+    {
+        DDFCacheRecordEvent(kDDFCacheEventFinishEntry);
 
-    delete[] memfile;
+        (*readinfo->finish_entry)();
+    }
 
     cur_ddf_entryname.clear();
     cur_ddf_filename.clear();
@@ -1103,6 +1257,156 @@ void DDFMainGetString(const char *info, void *storage)
     *dest = info;
 }
 
+// Command lists are looked up through a perfect hash of their names,
+// interned as epi::ENames in the form DDFCompareName() considers
+// equal.  The hash is built the first time each list is used.
+class DDFCommandTable
+{
+  public:
+    // position in the command list, -1 for an empty slot
+    std::vector<int> slots_;
+
+    uint32_t multiplier_;
+    int      shift_;
+
+    // positions of the "*name" sub-field entries
+    std::vector<int> subfields_;
+
+  public:
+    DDFCommandTable() : slots_(), multiplier_(1), shift_(31), subfields_()
+    {
+    }
+
+    ~DDFCommandTable()
+    {
+    }
+
+    int Slot(int name_index) const
+    {
+        return (int)(((uint32_t)name_index * multiplier_) >> shift_);
+    }
+};
+
+static std::unordered_map<const DDFCommandList *, DDFCommandTable *> command_tables;
+
+static const char *DDFCommandName(const DDFCommandList *command)
+{
+    const char *name = command->name;
+
+    if (name[0] == '!')
+        name++;
+
+    return name;
+}
+
+// the interned form of a field name (see DDFNameKey).  With no_create,
+// a name never interned before gives kENameNone.
+static epi::EName DDFCommandKey(const char *field, bool no_create)
+{
+    char key[64];
+    int  len = 0;
+
+    for (const char *pos = field; *pos; pos++)
+    {
+        if (*pos == ' ' || *pos == '_')
+            continue;
+
+        // rare, so not worth avoiding the allocation
+        if (len == (int)sizeof(key))
+            return epi::EName(DDFNameKey(field), no_create);
+
+        key[len++] = epi::ToUpperASCII(*pos);
+    }
+
+    return epi::EName(std::string_view(key, len), no_create);
+}
+
+static DDFCommandTable *DDFBuildCommandTable(const DDFCommandList *commands)
+{
+    DDFCommandTable *table = new DDFCommandTable;
+
+    std::vector<int> name_indices;
+    std::vector<int> positions;
+
+    for (int i = 0; commands[i].name; i++)
+    {
+        const char *name = DDFCommandName(&commands[i]);
+
+        if (name[0] == '*')
+        {
+            table->subfields_.push_back(i);
+            continue;
+        }
+
+        epi::EName key = DDFCommandKey(name, false);
+
+        // like the old linear search, the first of any duplicates wins
+        bool duplicate = false;
+
+        for (int index : name_indices)
+        {
+            if (index == key.GetIndex())
+                duplicate = true;
+        }
+
+        if (duplicate)
+            continue;
+
+        name_indices.push_back(key.GetIndex());
+        positions.push_back(i);
+    }
+
+    // find a table size and multiplier without any collisions
+    for (int bits = 1;; bits++)
+    {
+        int size = 1 << bits;
+
+        if (size < (int)name_indices.size() * 2)
+            continue;
+
+        uint32_t multiplier = 0x9E3779B1;
+
+        for (int attempt = 0; attempt < 32; attempt++)
+        {
+            table->multiplier_ = multiplier;
+            table->shift_      = 32 - bits;
+
+            table->slots_.assign(size, -1);
+
+            bool perfect = true;
+
+            for (size_t k = 0; k < name_indices.size() && perfect; k++)
+            {
+                int slot = table->Slot(name_indices[k]);
+
+                if (table->slots_[slot] >= 0)
+                    perfect = false;
+                else
+                    table->slots_[slot] = positions[k];
+            }
+
+            if (perfect)
+                return table;
+
+            multiplier = (multiplier * 0x2C9277B5 + 0xAC564B05) | 1;
+        }
+    }
+}
+
+static const DDFCommandTable *DDFGetCommandTable(const DDFCommandList *commands)
+{
+    auto find = command_tables.find(commands);
+
+    if (find != command_tables.end())
+        return find->second;
+
+    DDFCommandTable *table = DDFBuildCommandTable(commands);
+
+    command_tables[commands] = table;
+
+    return table;
+}
+
 //
 // DDFMainParseField
 //
@@ -1113,43 +1417,45 @@ bool DDFMainParseField(const DDFCommandList *commands, const char *field, const
 {
     EPI_ASSERT(obj_base);
 
-    for (int i = 0; commands[i].name; i++)
-    {
-        const char *name = commands[i].name;
-
-        if (name[0] == '!')
-            name++;
+    const DDFCommandTable *table = DDFGetCommandTable(commands);
 
-        // handle subfields
-        if (name[0] == '*')
-        {
-            name++;
+    int found = -1;
 
-            int len = strlen(name);
-            EPI_ASSERT(len > 0);
+    // unknown names are not interned, the slot check rejects them
+    epi::EName key = DDFCommandKey(field, true);
 
-            if (strncmp(field, name, len) == 0 && field[len] == '.' && epi::IsAlphanumericASCII(field[len + 1]))
-            {
-                // recursively parse the sub-field
-                return DDFMainParseField(commands[i].sub_comms, field + len + 1, contents,
-                                         obj_base + commands[i].offset);
-            }
+    int pos = table->slots_[table->Slot(key.GetIndex())];
 
-            continue;
-        }
+    if (pos >= 0 && DDFCompareName(field, DDFCommandName(&commands[pos])) == 0)
+        found = pos;
 
-        if (DDFCompareName(field, name) != 0)
-            continue;
+    // handle subfields, an earlier entry takes precedence
+    for (int i : table->subfields_)
+    {
+        if (found >= 0 && i > found)
+            break;
 
-        // found it, so call parse routine
-        EPI_ASSERT(commands[i].parse_command);
+        const char *name = DDFCommandName(&commands[i]) + 1;
 
-        (*commands[i].parse_command)(contents, obj_base + commands[i].offset);
+        int len = strlen(name);
+        EPI_ASSERT(len > 0);
 
-        return true;
+        if (strncmp(field, name, len) == 0 && field[len] == '.' && epi::IsAlphanumericASCII(field[len + 1]))
+        {
+            // recursively parse the sub-field
+            return DDFMainParseField(commands[i].sub_comms, field + len + 1, contents, obj_base + commands[i].offset);
+        }
     }
 
-    return false;
+    if (found < 0)
+        return false;
+
+    // found it, so call parse routine
+    EPI_ASSERT(commands[found].parse_command);
+
+    (*commands[found].parse_command)(contents, obj_base + commands[found].offset);
+
+    return true;
 }
 
 void DDFMainGetLumpName(const char *info, void *storage)
@@ -2157,8 +2463,12 @@ void DDFParseEverything()
     //       sense to load all lumps of a certain type together, for example
     //       all DDFSFX lumps before all the DDFTHING lumps.
 
+    DDFCacheBegin(unread_ddf);
+
     for (size_t d = 0; d < kTotalDDFTypes; d++)
         DDFParseUnreadFile(d);
+
+    DDFCacheFinish();
 }
 
 //--- editor settings ---
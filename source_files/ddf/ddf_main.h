@@ -153,6 +153,10 @@ void DDFAddFile(DDFType type, std::string &data, const std::string &source);
 void DDFAddCollection(std::vector<DDFFile> &col, const std::string &source);
 void DDFParseEverything();
 
+// enables the binary cache of parsed DDF.  `version' is the engine
+// version, a cache written by any other version is ignored.
+void DDFSetCacheFile(const std::string &filename, const std::string &version);
+
 void DDFDumpFile(const std::string &data);
 void DDFDumpCollection(const std::vector<DDFFile> &col);
 
@@ -559,25 +559,10 @@ SectorType *SectorTypeContainer::Lookup(const int id)
     if (id == 0)
         return default_sector;
 
-    int slot = (((id) + kLookupCacheSize) % kLookupCacheSize);
+    int idx = number_index_.FindLast(*this, id);
 
-    // check the cache
-    if (lookup_cache_[slot] && lookup_cache_[slot]->number_ == id)
-    {
-        return lookup_cache_[slot];
-    }
-
-    for (auto iter = rbegin(); iter != rend(); iter++)
-    {
-        SectorType *s = *iter;
-
-        if (s->number_ == id)
-        {
-            // update the cache
-            lookup_cache_[slot] = s;
-            return s;
-        }
-    }
+    if (idx >= 0)
+        return (*this)[idx];
 
     return nullptr;
 }
@@ -585,7 +570,7 @@ SectorType *SectorTypeContainer::Lookup(const int id)
 //
 // SectorTypeContainer::Reset()
 //
-// Clears down both the data and the cache
+// Clears down both the data and the index
 //
 void SectorTypeContainer::Reset()
 {
@@ -596,7 +581,7 @@ void SectorTypeContainer::Reset()
         sec = nullptr;
     }
     clear();
-    memset(lookup_cache_, 0, sizeof(SectorType *) * kLookupCacheSize);
+    number_index_.Invalidate();
 }
 
 //--- editor settings ---
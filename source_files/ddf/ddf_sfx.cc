@@ -141,6 +141,7 @@ void DDFSFXInit(void)
         s = nullptr;
     }
     sfxdefs.clear();
+    sfxdefs.InvalidateIndex();
 }
 
 void DDFSFXCleanUp(void)
@@ -323,13 +324,10 @@ SoundEffect *SoundEffectDefinitionContainer::GetEffect(const char *name, bool er
 //
 SoundEffectDefinition *SoundEffectDefinitionContainer::Lookup(const char *name)
 {
-    for (std::vector<SoundEffectDefinition *>::iterator iter = begin(), iter_end = end(); iter != iter_end; iter++)
-    {
-        SoundEffectDefinition *s = *iter;
+    int idx = name_index_.FindFirst(*this, name);
 
-        if (DDFCompareName(s->name_.c_str(), name) == 0)
-            return s;
-    }
+    if (idx >= 0)
+        return (*this)[idx];
 
     return nullptr;
 }
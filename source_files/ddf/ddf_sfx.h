@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "ddf_index.h"
 #include "ddf_types.h"
 
 // ----------------------------------------------------------------
@@ -108,10 +109,18 @@ class SoundEffectDefinitionContainer : public std::vector<SoundEffectDefinition
         }
     }
 
+  private:
+    DDFNameIndex<SoundEffectDefinition> name_index_;
+
   public:
     // Lookup functions
     SoundEffect           *GetEffect(const char *name, bool error = true);
     SoundEffectDefinition *Lookup(const char *name);
+
+    void InvalidateIndex()
+    {
+        name_index_.Invalidate();
+    }
 };
 
 // ----------EXTERNALISATIONS----------
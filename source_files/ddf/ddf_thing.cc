@@ -538,6 +538,26 @@ int DDFCompareName(const char *A, const char *B)
     }
 }
 
+//
+// DDFNameKey
+//
+// Returns the name with spaces and underscores removed and
+// upper-cased, so that two names are equal under DDFCompareName()
+// exactly when their keys are equal.
+//
+std::string DDFNameKey(const char *name)
+{
+    std::string key;
+
+    for (; *name; name++)
+    {
+        if (*name != ' ' && *name != '_')
+            key.push_back(epi::ToUpperASCII(*name));
+    }
+
+    return key;
+}
+
 //
 //  DDF PARSE ROUTINES
 //
@@ -586,7 +606,10 @@ static void ThingStartEntry(const char *buffer, bool extend)
             DDFError("Unknown thing to extend: %s\n", name.c_str());
 
         if (number > 0)
+        {
             dynamic_mobj->number_ = number;
+            mobjtypes.InvalidateIndex();
+        }
 
         DDFStateBeginRange(dynamic_mobj->state_grp_);
         return;
@@ -597,6 +620,7 @@ static void ThingStartEntry(const char *buffer, bool extend)
     {
         dynamic_mobj->Default();
         dynamic_mobj->number_ = number;
+        mobjtypes.InvalidateIndex();
     }
     else
     {
@@ -816,6 +840,7 @@ void DDFMobjInit(void)
         m = nullptr;
     }
     mobjtypes.clear();
+    mobjtypes.InvalidateIndex();
 
     default_mobjtype          = new MapObjectDefinition();
     default_mobjtype->name_   = "__DEFAULT_MOBJ";
@@ -841,6 +866,10 @@ void DDFMobjCleanUp(void)
         cur_ddf_entryname.clear();
     }
 
+    // #EXTEND entries may have changed cast order, player number or
+    // keys in place.
+    mobjtypes.InvalidateIndex();
+
     mobjtypes.shrink_to_fit();
 }
 
@@ -2330,7 +2359,6 @@ void MapObjectDefinition::DLightCompatibility(void)
 
 MapObjectDefinitionContainer::MapObjectDefinitionContainer()
 {
-    memset(lookup_cache_, 0, sizeof(MapObjectDefinition *) * kLookupCacheSize);
 }
 
 MapObjectDefinitionContainer::~MapObjectDefinitionContainer()
@@ -2345,7 +2373,8 @@ MapObjectDefinitionContainer::~MapObjectDefinitionContainer()
 
 int MapObjectDefinitionContainer::FindFirst(const char *name, int startpos)
 {
-    startpos = HMM_MAX(startpos, 0);
+    if (startpos <= 0)
+        return name_index_.FindFirst(*this, name);
 
     for (; startpos < size(); startpos++)
     {
@@ -2359,7 +2388,8 @@ int MapObjectDefinitionContainer::FindFirst(const char *name, int startpos)
 
 int MapObjectDefinitionContainer::FindLast(const char *name, int startpos)
 {
-    startpos = HMM_MIN(startpos, size() - 1);
+    if (startpos < 0 || startpos >= (int)size() - 1)
+        return name_index_.FindLast(*this, name);
 
     for (; startpos >= 0; startpos--)
     {
@@ -2390,9 +2420,22 @@ bool MapObjectDefinitionContainer::MoveToEnd(int idx)
 
     push_back(m);
 
+    InvalidateIndex();
+
     return true;
 }
 
+void MapObjectDefinitionContainer::InvalidateIndex()
+{
+    // Must be called when entries are renumbered or reordered in place.
+
+    name_index_.Invalidate();
+    number_index_.Invalidate();
+    cast_index_.Invalidate();
+    player_index_.Invalidate();
+    door_key_index_.Invalidate();
+}
+
 const MapObjectDefinition *MapObjectDefinitionContainer::Lookup(const char *refname)
 {
     // Looks an mobjdef by name.
@@ -2418,26 +2461,10 @@ const MapObjectDefinition *MapObjectDefinitionContainer::Lookup(int id)
     // Looks an mobjdef by number.
     // Fatal error if it does not exist.
 
-    int slot = (((id) + kLookupCacheSize) % kLookupCacheSize);
-
-    // check the cache
-    if (lookup_cache_[slot] && lookup_cache_[slot]->number_ == id)
-    {
-        return lookup_cache_[slot];
-    }
-
-    for (std::vector<MapObjectDefinition *>::reverse_iterator iter = rbegin(), iter_end = rend(); iter != iter_end;
-         iter++)
-    {
-        MapObjectDefinition *m = *iter;
+    int idx = number_index_.FindLast(*this, id);
 
-        if (m->number_ == id)
-        {
-            // update the cache
-            lookup_cache_[slot] = m;
-            return m;
-        }
-    }
+    if (idx >= 0)
+        return (*this)[idx];
 
     return nullptr;
 }
@@ -2447,6 +2474,13 @@ const MapObjectDefinition *MapObjectDefinitionContainer::LookupCastMember(int ca
     // Lookup the cast member of the one with the nearest match
     // to the position given.
 
+    int idx = cast_index_.FindLast(*this, castpos);
+
+    if (idx >= 0)
+        return (*this)[idx]; // Exact match
+
+    // no exact match (the end of the cast), look for the nearest
+
     MapObjectDefinition *best = nullptr;
     MapObjectDefinition *m    = nullptr;
 
@@ -2510,14 +2544,10 @@ const MapObjectDefinition *MapObjectDefinitionContainer::LookupCastMember(int ca
 const MapObjectDefinition *MapObjectDefinitionContainer::LookupPlayer(int playernum)
 {
     // Find a player thing (needed by deathmatch code).
-    for (std::vector<MapObjectDefinition *>::reverse_iterator iter = rbegin(), iter_end = rend(); iter != iter_end;
-         iter++)
-    {
-        MapObjectDefinition *m = *iter;
+    int idx = player_index_.FindLast(*this, playernum);
 
-        if (m->playernum_ == playernum)
-            return m;
-    }
+    if (idx >= 0)
+        return (*this)[idx];
 
     FatalError("Missing DDF entry for player number %d\n", playernum);
     return nullptr; /* NOT REACHED */
@@ -2543,24 +2573,10 @@ const MapObjectDefinition *MapObjectDefinitionContainer::LookupDoorKey(int theKe
         }
     */
 
-    for (std::vector<MapObjectDefinition *>::reverse_iterator iter = rbegin(), iter_end = rend(); iter != iter_end;
-         iter++)
-    {
-        MapObjectDefinition *m = *iter;
+    int idx = door_key_index_.FindLast(*this, theKey);
 
-        Benefit *list;
-        list = m->pickup_benefits_;
-        for (; list != nullptr; list = list->next)
-        {
-            if (list->type == kBenefitTypeKey)
-            {
-                if (list->sub.type == theKey)
-                {
-                    return m;
-                }
-            }
-        }
-    }
+    if (idx >= 0)
+        return (*this)[idx];
 
     LogWarning("Missing DDF entry for key %d\n", theKey);
     return nullptr;
@@ -19,6 +19,7 @@
 #pragma once
 
 #include "ddf_colormap.h"
+#include "ddf_index.h"
 #include "ddf_states.h"
 #include "ddf_types.h"
 #include "epi_bitset.h"
@@ -885,6 +886,59 @@ class MapObjectDefinition
     }
 };
 
+// number indexes for the cast, player and door key lookups
+class MapObjectCastOrderField
+{
+  public:
+    static void Add(std::unordered_map<int, int> &numbers, const MapObjectDefinition *entry, int pos)
+    {
+        if (entry->castorder_ > 0)
+            numbers[entry->castorder_] = pos;
+    }
+
+    static bool Has(const MapObjectDefinition *entry, int number)
+    {
+        return entry->castorder_ > 0 && entry->castorder_ == number;
+    }
+};
+
+class MapObjectPlayerNumberField
+{
+  public:
+    static void Add(std::unordered_map<int, int> &numbers, const MapObjectDefinition *entry, int pos)
+    {
+        numbers[entry->playernum_] = pos;
+    }
+
+    static bool Has(const MapObjectDefinition *entry, int number)
+    {
+        return entry->playernum_ == number;
+    }
+};
+
+class MapObjectDoorKeyField
+{
+  public:
+    static void Add(std::unordered_map<int, int> &numbers, const MapObjectDefinition *entry, int pos)
+    {
+        for (Benefit *list = entry->pickup_benefits_; list != nullptr; list = list->next)
+        {
+            if (list->type == kBenefitTypeKey)
+                numbers[list->sub.type] = pos;
+        }
+    }
+
+    static bool Has(const MapObjectDefinition *entry, int number)
+    {
+        for (Benefit *list = entry->pickup_benefits_; list != nullptr; list = list->next)
+        {
+            if (list->type == kBenefitTypeKey && list->sub.type == number)
+                return true;
+        }
+        return false;
+    }
+};
+
 class MapObjectDefinitionContainer : public std::vector<MapObjectDefinition *>
 {
   public:
@@ -892,11 +946,17 @@ class MapObjectDefinitionContainer : public std::vector<MapObjectDefinition *>
     ~MapObjectDefinitionContainer();
 
   private:
-    MapObjectDefinition *lookup_cache_[kLookupCacheSize];
+    DDFNameIndex<MapObjectDefinition>   name_index_;
+    DDFNumberIndex<MapObjectDefinition> number_index_;
+
+    DDFNumberIndex<MapObjectDefinition, MapObjectCastOrderField>    cast_index_;
+    DDFNumberIndex<MapObjectDefinition, MapObjectPlayerNumberField> player_index_;
+    DDFNumberIndex<MapObjectDefinition, MapObjectDoorKeyField>      door_key_index_;
 
   public:
     // List Management
     bool MoveToEnd(int idx);
+    void InvalidateIndex();
 
     // Search Functions
     int                        FindFirst(const char *name, int startpos = -1);
@@ -35,8 +35,6 @@
 class MapObjectDefinition;
 class WeaponDefinition;
 
-constexpr uint8_t kLookupCacheSize = 211; // Why this number? - Dasho
-
 class MobjStringReference
 {
   public:
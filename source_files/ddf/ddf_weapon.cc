@@ -574,6 +574,7 @@ void DDFWeaponInit(void)
         w = nullptr;
     }
     weapondefs.clear();
+    weapondefs.InvalidateIndex();
 }
 
 void DDFWeaponCleanUp(void)
@@ -911,7 +912,8 @@ WeaponDefinitionContainer::~WeaponDefinitionContainer()
 //
 int WeaponDefinitionContainer::FindFirst(const char *name, int startpos)
 {
-    startpos = HMM_MAX(startpos, 0);
+    if (startpos <= 0)
+        return name_index_.FindFirst(*this, name);
 
     for (; startpos < size(); startpos++)
     {
@@ -935,5 +937,15 @@ WeaponDefinition *WeaponDefinitionContainer::Lookup(const char *refname)
     return nullptr;
 }
 
+//
+// WeaponDefinitionContainer::InvalidateIndex()
+//
+// Must be called when entries are renamed or reordered in place.
+//
+void WeaponDefinitionContainer::InvalidateIndex()
+{
+    name_index_.Invalidate();
+}
+
 //--- editor settings ---
 // vi:ts=4:sw=4:noexpandtab
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "ddf_index.h"
 #include "ddf_states.h"
 #include "ddf_types.h"
 
@@ -33,10 +34,14 @@ class WeaponDefinitionContainer : public std::vector<WeaponDefinition *>
     WeaponDefinitionContainer();
     ~WeaponDefinitionContainer();
 
+  private:
+    DDFNameIndex<WeaponDefinition> name_index_;
+
   public:
     // Search Functions
     int               FindFirst(const char *name, int startpos = -1);
     WeaponDefinition *Lookup(const char *refname);
+    void              InvalidateIndex();
 };
 
 // -------EXTERNALISATIONS-------
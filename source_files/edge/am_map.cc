@@ -29,6 +29,8 @@
 #include <math.h>
 #include <stdio.h>
 
+#include <vector>
+
 #include "AlmostEquals.h"
 #include "con_main.h"
 #include "con_var.h"
@@ -259,8 +261,12 @@ void AutomapSetArrow(AutomapArrowStyle type)
         current_arrow_type = type;
 }
 
+static void AutomapClearCache(void);
+
 void AutomapInitLevel(void)
 {
+    AutomapClearCache();
+
     if (!cheat_automap.sequence)
     {
         cheat_automap.sequence = language["iddt"];
@@ -557,37 +563,6 @@ static void DrawMLine(AutomapLine *ml, RGBAColor rgb, bool thick = true)
     HUDSolidLine(x1, y1, x2, y2, rgb, thick ? 1.5f : 1.0f, thick, dx, dy);
 }
 
-// Lobo 2022: keyed doors automap colouring
-static void DrawMLineDoor(AutomapLine *ml, RGBAColor rgb)
-{
-    if (hide_lines)
-        return;
-
-    float x1 = MapToFrameCoordinatesX(ml->a.x, 0);
-    float y1 = MapToFrameCoordinatesY(ml->a.y, 0);
-
-    float x2 = MapToFrameCoordinatesX(ml->b.x, 0);
-    float y2 = MapToFrameCoordinatesY(ml->b.y, 0);
-
-    float dx = MapToFrameDistanceX(-map_center_x);
-    float dy = MapToFrameDistanceY(-map_center_y);
-
-    float linewidth = 3.5f;
-
-    // Lobo 2023: Make keyed doors pulse
-    if (automap_keydoor_blink)
-    {
-        linewidth = game_tic % 32;
-
-        if (linewidth >= 16)
-            linewidth = 2.0 + (linewidth * 0.1f);
-        else
-            linewidth = 2.0 - (linewidth * 0.1f);
-    }
-
-    HUDSolidLine(x1, y1, x2, y2, rgb, linewidth, true, dx, dy);
-}
-
 static AutomapLine player_dagger[] = {
     {{-0.75f, 0.0f}, {0.0f, 0.0f}},                                          // center line
 
@@ -832,11 +807,110 @@ static bool CheckSimiliarRegions(Sector *front, Sector *back)
 }
 
 //
-// Determines visible lines, draws them.
+// Cached automap lines.
+//
+// Classifying every seg is the slow part of drawing the automap, and
+// the result only changes when the world does.  The lines are sorted
+// into batches by colour and style and kept, in map coordinates, until
+// automap_changes is bumped (a line becoming mapped, a sector moving,
+// a line special changing, a savegame load), the colours change, the
+// iddt or allmap state changes, or automap_debug_bsp is toggled.  Each
+// frame merely transforms the batches to the screen and draws each
+// one with a single call.
+//
+
+enum AutomapLineStyle
+{
+    kAutomapLineThick = 0,
+    kAutomapLineThin,
+    kAutomapLineDoor
+};
+
+class AutomapLineBatch
+{
+  public:
+    RGBAColor        color_;
+    AutomapLineStyle style_;
+
+    std::vector<AutomapLine> lines_;
+};
+
+class AutomapKeyLabel
+{
+  public:
+    AutomapLine line_;
+    int         key_;
+};
+
+static std::vector<AutomapLineBatch> line_batches;
+static std::vector<AutomapKeyLabel>  key_labels;
+
+int automap_changes = 0;
+
+// what the cache was made from
+class AutomapCacheKey
+{
+  public:
+    const Subsector *subsectors_;
+    int              changes_;
+    int              color_changes_;
+    bool             show_walls_;
+    bool             show_allmap_;
+    int              debug_bsp_;
+
+    bool operator==(const AutomapCacheKey &other) const
+    {
+        return subsectors_ == other.subsectors_ && changes_ == other.changes_ &&
+               color_changes_ == other.color_changes_ && show_walls_ == other.show_walls_ &&
+               show_allmap_ == other.show_allmap_ && debug_bsp_ == other.debug_bsp_;
+    }
+};
+
+static AutomapCacheKey cache_key   = {nullptr, 0, 0, false, false, 0};
+static bool            cache_valid = false;
+
+static int color_changes = 0;
+
+// HUD coordinates of one batch, reused every frame
+static std::vector<float> batch_coords;
+
+static void AutomapCacheLine(const AutomapLine &l, RGBAColor rgb, AutomapLineStyle style)
+{
+    for (AutomapLineBatch &batch : line_batches)
+    {
+        if (batch.color_ == rgb && batch.style_ == style)
+        {
+            batch.lines_.push_back(l);
+            return;
+        }
+    }
+
+    line_batches.push_back(AutomapLineBatch());
+
+    line_batches.back().color_ = rgb;
+    line_batches.back().style_ = style;
+    line_batches.back().lines_.push_back(l);
+}
+
+static void AutomapCacheKeyLabel(const AutomapLine &l, int key)
+{
+    key_labels.push_back({l, key});
+}
+
+static void AutomapClearCache(void)
+{
+    line_batches.clear();
+    key_labels.clear();
+
+    cache_valid = false;
+}
+
+//
+// Determines visible lines, adds them to the cache.
 //
 // -AJA- This is now *lineseg* based, not linedef.
 //
-static void AutomapWalkSeg(Seg *seg)
+static void AutomapCacheSeg(Seg *seg)
 {
     AutomapLine l;
     Line       *line;
@@ -851,9 +925,9 @@ static void AutomapWalkSeg(Seg *seg)
             if (seg->partner && seg > seg->partner)
                 return;
 
-            GetRotatedCoords(seg->vertex_1->X, seg->vertex_1->Y, l.a.x, l.a.y);
-            GetRotatedCoords(seg->vertex_2->X, seg->vertex_2->Y, l.b.x, l.b.y);
-            DrawMLine(&l, epi::MakeRGBA(0, 0, 128), false);
+            l.a = {seg->vertex_1->X, seg->vertex_1->Y};
+            l.b = {seg->vertex_2->X, seg->vertex_2->Y};
+            AutomapCacheLine(l, epi::MakeRGBA(0, 0, 128), kAutomapLineThin);
         }
         return;
     }
@@ -865,8 +939,8 @@ static void AutomapWalkSeg(Seg *seg)
     if (line->side[1] == seg->sidedef)
         return;
 
-    GetRotatedCoords(seg->vertex_1->X, seg->vertex_1->Y, l.a.x, l.a.y);
-    GetRotatedCoords(seg->vertex_2->X, seg->vertex_2->Y, l.b.x, l.b.y);
+    l.a = {seg->vertex_1->X, seg->vertex_1->Y};
+    l.b = {seg->vertex_2->X, seg->vertex_2->Y};
 
     if ((line->flags & kLineFlagMapped) || show_walls)
     {
@@ -875,7 +949,7 @@ static void AutomapWalkSeg(Seg *seg)
 
         if (!front || !back)
         {
-            DrawMLine(&l, am_colors[kAutomapColorWall]);
+            AutomapCacheLine(l, am_colors[kAutomapColorWall], kAutomapLineThick);
         }
         else
         {
@@ -886,64 +960,64 @@ static void AutomapWalkSeg(Seg *seg)
                 {
                     if (line->special->keys_ & kDoorKeyStrictlyAllKeys)
                     {
-                        DrawMLineDoor(&l, SG_PURPLE_RGBA32); // purple
-                        DrawKeyOnLine(&l, kDoorKeyStrictlyAllKeys);
+                        AutomapCacheLine(l, SG_PURPLE_RGBA32, kAutomapLineDoor); // purple
+                        AutomapCacheKeyLabel(l, kDoorKeyStrictlyAllKeys);
                     }
                     else if (line->special->keys_ & kDoorKeyBlueCard || line->special->keys_ & kDoorKeyBlueSkull)
                     {
-                        DrawMLineDoor(&l, SG_BLUE_RGBA32); // blue
+                        AutomapCacheLine(l, SG_BLUE_RGBA32, kAutomapLineDoor); // blue
                         if (line->special->keys_ & (kDoorKeyBlueSkull | kDoorKeyBlueCard))
                         {
-                            DrawKeyOnLine(&l, kDoorKeyBlueCard);
-                            DrawKeyOnLine(&l, kDoorKeyBlueSkull);
+                            AutomapCacheKeyLabel(l, kDoorKeyBlueCard);
+                            AutomapCacheKeyLabel(l, kDoorKeyBlueSkull);
                         }
                         else if (line->special->keys_ & kDoorKeyBlueCard)
-                            DrawKeyOnLine(&l, kDoorKeyBlueCard);
+                            AutomapCacheKeyLabel(l, kDoorKeyBlueCard);
                         else
-                            DrawKeyOnLine(&l, kDoorKeyBlueSkull);
+                            AutomapCacheKeyLabel(l, kDoorKeyBlueSkull);
                     }
                     else if (line->special->keys_ & kDoorKeyYellowCard || line->special->keys_ & kDoorKeyYellowSkull)
                     {
-                        DrawMLineDoor(&l, SG_YELLOW_RGBA32); // yellow
+                        AutomapCacheLine(l, SG_YELLOW_RGBA32, kAutomapLineDoor); // yellow
                         if (line->special->keys_ & (kDoorKeyYellowSkull | kDoorKeyYellowCard))
                         {
-                            DrawKeyOnLine(&l, kDoorKeyYellowCard);
-                            DrawKeyOnLine(&l, kDoorKeyYellowSkull);
+                            AutomapCacheKeyLabel(l, kDoorKeyYellowCard);
+                            AutomapCacheKeyLabel(l, kDoorKeyYellowSkull);
                         }
                         else if (line->special->keys_ & kDoorKeyYellowCard)
-                            DrawKeyOnLine(&l, kDoorKeyYellowCard);
+                            AutomapCacheKeyLabel(l, kDoorKeyYellowCard);
                         else
-                            DrawKeyOnLine(&l, kDoorKeyYellowSkull);
+                            AutomapCacheKeyLabel(l, kDoorKeyYellowSkull);
                     }
                     else if (line->special->keys_ & kDoorKeyRedCard || line->special->keys_ & kDoorKeyRedSkull)
                     {
-                        DrawMLineDoor(&l, SG_RED_RGBA32); // red
+                        AutomapCacheLine(l, SG_RED_RGBA32, kAutomapLineDoor); // red
                         if (line->special->keys_ & (kDoorKeyRedSkull | kDoorKeyRedCard))
                         {
-                            DrawKeyOnLine(&l, kDoorKeyRedCard);
-                            DrawKeyOnLine(&l, kDoorKeyRedSkull);
+                            AutomapCacheKeyLabel(l, kDoorKeyRedCard);
+                            AutomapCacheKeyLabel(l, kDoorKeyRedSkull);
                         }
                         else if (line->special->keys_ & kDoorKeyRedCard)
-                            DrawKeyOnLine(&l, kDoorKeyRedCard);
+                            AutomapCacheKeyLabel(l, kDoorKeyRedCard);
                         else
-                            DrawKeyOnLine(&l, kDoorKeyRedSkull);
+                            AutomapCacheKeyLabel(l, kDoorKeyRedSkull);
                     }
                     else if (line->special->keys_ & kDoorKeyGreenCard || line->special->keys_ & kDoorKeyGreenSkull)
                     {
-                        DrawMLineDoor(&l, SG_GREEN_RGBA32); // green
+                        AutomapCacheLine(l, SG_GREEN_RGBA32, kAutomapLineDoor); // green
                         if (line->special->keys_ & (kDoorKeyGreenSkull | kDoorKeyGreenCard))
                         {
-                            DrawKeyOnLine(&l, kDoorKeyGreenCard);
-                            DrawKeyOnLine(&l, kDoorKeyGreenSkull);
+                            AutomapCacheKeyLabel(l, kDoorKeyGreenCard);
+                            AutomapCacheKeyLabel(l, kDoorKeyGreenSkull);
                         }
                         else if (line->special->keys_ & kDoorKeyGreenCard)
-                            DrawKeyOnLine(&l, kDoorKeyGreenCard);
+                            AutomapCacheKeyLabel(l, kDoorKeyGreenCard);
                         else
-                            DrawKeyOnLine(&l, kDoorKeyGreenSkull);
+                            AutomapCacheKeyLabel(l, kDoorKeyGreenSkull);
                     }
                     else
                     {
-                        DrawMLineDoor(&l, SG_PURPLE_RGBA32); // purple
+                        AutomapCacheLine(l, SG_PURPLE_RGBA32, kAutomapLineDoor); // purple
                     }
                     return;
                 }
@@ -952,9 +1026,9 @@ static void AutomapWalkSeg(Seg *seg)
             {
                 // secret door
                 if (show_walls)
-                    DrawMLine(&l, am_colors[kAutomapColorSecret]);
+                    AutomapCacheLine(l, am_colors[kAutomapColorSecret], kAutomapLineThick);
                 else
-                    DrawMLine(&l, am_colors[kAutomapColorWall]);
+                    AutomapCacheLine(l, am_colors[kAutomapColorWall], kAutomapLineThick);
             }
             else if (!AlmostEquals(back->floor_height, front->floor_height))
             {
@@ -962,28 +1036,28 @@ static void AutomapWalkSeg(Seg *seg)
 
                 // floor level change
                 if (diff > 24)
-                    DrawMLine(&l, am_colors[kAutomapColorLedge]);
+                    AutomapCacheLine(l, am_colors[kAutomapColorLedge], kAutomapLineThick);
                 else
-                    DrawMLine(&l, am_colors[kAutomapColorStep]);
+                    AutomapCacheLine(l, am_colors[kAutomapColorStep], kAutomapLineThick);
             }
             else if (!AlmostEquals(back->ceiling_height, front->ceiling_height))
             {
                 // ceiling level change
-                DrawMLine(&l, am_colors[kAutomapColorCeil]);
+                AutomapCacheLine(l, am_colors[kAutomapColorCeil], kAutomapLineThick);
             }
             else if ((front->extrafloor_used > 0 || back->extrafloor_used > 0) &&
                      (front->extrafloor_used != back->extrafloor_used || !CheckSimiliarRegions(front, back)))
             {
                 // -AJA- 1999/10/09: extra floor change.
-                DrawMLine(&l, am_colors[kAutomapColorLedge]);
+                AutomapCacheLine(l, am_colors[kAutomapColorLedge], kAutomapLineThick);
             }
             else if (show_walls)
             {
-                DrawMLine(&l, am_colors[kAutomapColorAllmap]);
+                AutomapCacheLine(l, am_colors[kAutomapColorAllmap], kAutomapLineThick);
             }
             else if (line->slide_door)
             { // Lobo: draw sliding doors on automap
-                DrawMLine(&l, am_colors[kAutomapColorCeil]);
+                AutomapCacheLine(l, am_colors[kAutomapColorCeil], kAutomapLineThick);
             }
         }
     }
@@ -991,7 +1065,124 @@ static void AutomapWalkSeg(Seg *seg)
              (show_allmap || !AlmostEquals(frame_focus->player_->powers_[kPowerTypeAllMap], 0.0f)))
     {
         if (!(line->flags & kLineFlagDontDraw))
-            DrawMLine(&l, am_colors[kAutomapColorAllmap]);
+            AutomapCacheLine(l, am_colors[kAutomapColorAllmap], kAutomapLineThick);
+    }
+}
+
+static void AutomapUpdateCache(void)
+{
+    AutomapCacheKey key;
+
+    key.subsectors_    = level_subsectors;
+    key.changes_       = automap_changes;
+    key.color_changes_ = color_changes;
+    key.show_walls_    = show_walls;
+    key.show_allmap_   = frame_focus->player_ &&
+                       (show_allmap || !AlmostEquals(frame_focus->player_->powers_[kPowerTypeAllMap], 0.0f));
+    key.debug_bsp_     = automap_debug_bsp.d_;
+
+    if (cache_valid && key == cache_key)
+        return;
+
+    for (AutomapLineBatch &batch : line_batches)
+        batch.lines_.clear();
+
+    key_labels.clear();
+
+    for (int i = 0; i < total_level_subsectors; i++)
+    {
+        for (Seg *seg = level_subsectors[i].segs; seg; seg = seg->subsector_next)
+            AutomapCacheSeg(seg);
+    }
+
+    cache_key   = key;
+    cache_valid = true;
+}
+
+static void DrawLineBatch(const AutomapLineBatch &batch)
+{
+    if (batch.lines_.empty())
+        return;
+
+    // these are separate to reduce the wobblies
+    float dx = MapToFrameDistanceX(-map_center_x);
+    float dy = MapToFrameDistanceY(-map_center_y);
+
+    float left   = frame_x - dx;
+    float right  = frame_x + frame_width - dx;
+    float top    = frame_y - dy;
+    float bottom = frame_y + frame_height - dy;
+
+    batch_coords.clear();
+
+    for (const AutomapLine &ml : batch.lines_)
+    {
+        float ax, ay, bx, by;
+
+        GetRotatedCoords(ml.a.x, ml.a.y, ax, ay);
+        GetRotatedCoords(ml.b.x, ml.b.y, bx, by);
+
+        float x1 = MapToFrameCoordinatesX(ax, 0);
+        float y1 = MapToFrameCoordinatesY(ay, 0);
+        float x2 = MapToFrameCoordinatesX(bx, 0);
+        float y2 = MapToFrameCoordinatesY(by, 0);
+
+        // skip lines wholly off one side of the window
+        if ((x1 < left && x2 < left) || (x1 > right && x2 > right) || (y1 < top && y2 < top) ||
+            (y1 > bottom && y2 > bottom))
+            continue;
+
+        batch_coords.push_back(x1);
+        batch_coords.push_back(y1);
+        batch_coords.push_back(x2);
+        batch_coords.push_back(y2);
+    }
+
+    int total = (int)batch_coords.size() / 4;
+
+    if (batch.style_ == kAutomapLineDoor)
+    {
+        float linewidth = 3.5f;
+
+        // Lobo 2022: keyed doors automap colouring
+        // Lobo 2023: Make keyed doors pulse
+        if (automap_keydoor_blink)
+        {
+            linewidth = game_tic % 32;
+
+            if (linewidth >= 16)
+                linewidth = 2.0 + (linewidth * 0.1f);
+            else
+                linewidth = 2.0 - (linewidth * 0.1f);
+        }
+
+        HUDSolidLines(batch_coords.data(), total, batch.color_, linewidth, true, dx, dy);
+        return;
+    }
+
+    bool thick = (batch.style_ == kAutomapLineThick && automap_smoothing.d_);
+
+    HUDSolidLines(batch_coords.data(), total, batch.color_, thick ? 1.5f : 1.0f, thick, dx, dy);
+}
+
+static void AutomapDrawLines(void)
+{
+    if (hide_lines)
+        return;
+
+    AutomapUpdateCache();
+
+    for (const AutomapLineBatch &batch : line_batches)
+        DrawLineBatch(batch);
+
+    for (const AutomapKeyLabel &label : key_labels)
+    {
+        AutomapLine l;
+
+        GetRotatedCoords(label.line_.a.x, label.line_.a.y, l.a.x, l.a.y);
+        GetRotatedCoords(label.line_.b.x, label.line_.b.y, l.b.x, l.b.y);
+
+        DrawKeyOnLine(&l, label.key_);
     }
 }
 
@@ -1180,18 +1371,13 @@ static void AutomapWalkThing(MapObject *mo)
 }
 
 //
-// Visit a subsector and draw everything.
+// Visit a subsector and draw its things (the lines come from the
+// cache, see AutomapDrawLines).
 //
 static void AutomapWalkSubsector(unsigned int num)
 {
     Subsector *sub = &level_subsectors[num];
 
-    // handle each seg
-    for (Seg *seg = sub->segs; seg; seg = seg->subsector_next)
-    {
-        AutomapWalkSeg(seg);
-    }
-
     // handle each thing
     for (MapObject *mo = sub->thing_list; mo; mo = mo->subsector_next_)
     {
@@ -1340,6 +1526,8 @@ void AutomapRender(float x, float y, float w, float h, MapObject *focus)
     if (grid && !rotate_map)
         DrawGrid();
 
+    AutomapDrawLines();
+
     // walk the bsp tree
     AutomapWalkBSPNode(root_node);
 
@@ -1351,6 +1539,8 @@ void AutomapSetColor(int which, RGBAColor color)
     EPI_ASSERT(0 <= which && which < kTotalAutomapColors);
 
     am_colors[which] = color;
+
+    color_changes++;
 }
 
 void AutomapGetState(int *state, float *zoom)
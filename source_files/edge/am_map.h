@@ -32,6 +32,9 @@
 extern bool            automap_active;
 extern bool            rotate_map;
 extern bool            automap_keydoor_blink;
+// incremented by anything that changes what the automap draws: a line
+// becoming mapped, a sector moving, a line special being changed.
+extern int             automap_changes;
 extern ConsoleVariable automap_keydoor_text;
 
 struct AutomapPoint
@@ -34,6 +34,7 @@
 #include "dm_state.h"
 #include "e_input.h"
 #include "e_player.h"
+#include "e_profile.h"
 #include "edge_profiling.h"
 #include "epi.h"
 #include "epi_str_compare.h"
@@ -1659,12 +1660,19 @@ void ConsoleShowFPS(void)
     int x = current_screen_width - XMUL * 16;
     int y = current_screen_height - FNSZ * 2;
 
+    // room for the timer names
+    if (abs(debug_fps.d_) >= 4)
+        x = current_screen_width - XMUL * 20;
+
     if (abs(debug_fps.d_) >= 2)
         y -= FNSZ;
 
     if (abs(debug_fps.d_) >= 3)
         y -= (FNSZ * 4);
 
+    if (abs(debug_fps.d_) >= 4)
+        y -= FNSZ * (kTotalProfileTimers + 1);
+
     SolidBox(x, y, current_screen_width, current_screen_height, SG_BLACK_RGBA32, 0.5);
 
     x += XMUL;
@@ -1718,6 +1726,21 @@ void ConsoleShowFPS(void)
         sprintf(textbuf, "%i texture", ec_frame_stats.draw_texture_change);
         DrawText(x, y, textbuf, SG_WEB_GRAY_RGBA32);
     }
+
+    // show profiler timers, averaged over the last kTicRate * 2 frames (70)
+
+    if (abs(debug_fps.d_) >= 4)
+    {
+        y -= FNSZ;
+        DrawText(x, y, "  ms profile", SG_WEB_GRAY_RGBA32);
+
+        for (int t = 0; t < kTotalProfileTimers; t++)
+        {
+            y -= FNSZ;
+            sprintf(textbuf, "%5.2f %s", ProfileAverage(t, kTicRate * 2), ProfileTimerName(t));
+            DrawText(x, y, textbuf, SG_WEB_GRAY_RGBA32);
+        }
+    }
 }
 
 void ConsoleShowPosition(void)
@@ -26,6 +26,7 @@
 #include "ddf_sfx.h"
 #include "dm_state.h"
 #include "e_input.h"
+#include "e_profile.h"
 #include "epi_filesystem.h"
 #include "epi_str_compare.h"
 #include "epi_str_util.h"
@@ -33,6 +34,7 @@
 #include "i_system.h"
 #include "m_menu.h"
 #include "m_misc.h"
+#include "r_misc.h"
 #include "s_sound.h"
 #include "version.h"
 #include "w_files.h"
@@ -454,6 +456,37 @@ int ConsoleCommandShowMaps(char **argv, int argc)
     return 0;
 }
 
+int ConsoleCommandPointBenchmark(char **argv, int argc)
+{
+    int total_points = 1000000;
+
+    if (argc >= 2)
+        total_points = atoi(argv[1]);
+
+    BenchmarkPointInSubsector(total_points);
+    return 0;
+}
+
+int ConsoleCommandProfileDump(char **argv, int argc)
+{
+    std::string filename = "profile.csv";
+
+    if (argc >= 2)
+        filename = argv[1];
+
+    if (!epi::IsPathAbsolute(filename))
+        filename = epi::PathAppend(home_directory, filename);
+
+    if (!ProfileDump(filename.c_str()))
+    {
+        LogPrint("Unable to write profile: %s\n", filename.c_str());
+        return 1;
+    }
+
+    LogPrint("Wrote profile: %s\n", filename.c_str());
+    return 0;
+}
+
 int ConsoleCommandShowGamepads(char **argv, int argc)
 {
     (void)argv;
@@ -594,6 +627,8 @@ const ConsoleCommand builtin_commands[] = {{"cat", ConsoleCommandType},
                                            {"map", ConsoleCommandMap},
                                            {"warp", ConsoleCommandMap}, // compatibility
                                            {"playsound", ConsoleCommandPlaySound},
+                                           {"pointbench", ConsoleCommandPointBenchmark},
+                                           {"profiledump", ConsoleCommandProfileDump},
                                            {"readme", ConsoleCommandReadme},
                                            {"browse", ConsoleCommandBrowse},
                                            {"pwd", ConsoleCommandPrintWorkingDir},
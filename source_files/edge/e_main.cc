@@ -48,12 +48,14 @@
 #include "dm_state.h"
 #include "dstrings.h"
 #include "e_input.h"
+#include "e_profile.h"
 #include "edge_profiling.h"
 #include "epi_file.h"
 #include "epi_filesystem.h"
 #include "epi_sdl.h"
 #include "epi_str_compare.h"
 #include "epi_str_util.h"
+#include "epi_thread.h"
 #include "f_finale.h"
 #include "f_interm.h"
 #include "g_game.h"
@@ -526,6 +528,11 @@ static void DoSystemStartup(void)
 
     SystemStartup();
 
+    // worker threads for parallel loading/building jobs.
+    // `-threads 0` keeps everything on the main thread.
+    std::string threads = ArgumentValue("threads");
+    epi::ThreadPoolStart(threads.empty() ? -1 : atoi(threads.c_str()));
+
     // -ES- 1998/09/11 Use ChangeResolution to enter gfx mode
 
     DumpResolutionList();
@@ -708,6 +715,8 @@ void EdgeDisplay(void)
             TakeScreenshot(false);
     }
 
+    ProfileFinishFrame();
+
     FinishFrame(); // page flip or blit buffer
 }
 
@@ -1997,6 +2006,7 @@ void EdgeShutdown(void)
     ShutdownSound();
     RendererShutdown();
     NetworkShutdown();
+    epi::ThreadPoolStop();
 }
 
 static void EdgeStartup(void)
@@ -2037,6 +2047,7 @@ static void EdgeStartup(void)
 
     InitializeRADScripts();
     ProcessMultipleFiles();
+    DDFSetCacheFile(epi::PathAppend(cache_directory, "ddf_cache.bin"), edge_version.s_);
     DDFParseEverything();
     // Must be done after WAD and DDF loading to check for potential
     // overrides of lump-specific image/sound/DDF defines
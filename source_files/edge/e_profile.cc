@@ -0,0 +1,189 @@
+//----------------------------------------------------------------------------
+//  EDGE Built-in Frame Profiler
+//----------------------------------------------------------------------------
+//
+//  Copyright (c) 2024 The EDGE Team.
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation; either version 3
+//  of the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//----------------------------------------------------------------------------
+
+#include "e_profile.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+
+#include "HandmadeMath.h"
+#include "con_var.h"
+#include "epi.h"
+#include "epi_filesystem.h"
+#include "epi_str_compare.h"
+
+// records the timers even when the overlay is not shown
+EDGE_DEFINE_CONSOLE_VARIABLE(debug_profile, "0", kConsoleVariableFlagNone)
+
+extern ConsoleVariable debug_fps;
+
+std::atomic<bool> profile_active(false);
+
+static const char *profile_timer_names[kTotalProfileTimers] = {"bsp_walk", "render_units", "thinkers", "sight",
+                                                               "sound_mixing", "lua_hud", "rts"};
+
+class ProfileFrame
+{
+  public:
+    // milliseconds
+    float frame_time_;
+    float timers_[kTotalProfileTimers];
+};
+
+static ProfileFrame profile_history[kProfileHistory];
+
+// frames in the history, and the slot of the next one
+static int profile_frames = 0;
+static int profile_next   = 0;
+
+// nanoseconds for the frame in progress
+static std::atomic<uint64_t> profile_current[kTotalProfileTimers];
+
+static uint64_t profile_frame_start = 0;
+
+uint64_t ProfileTimestamp(void)
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void ProfileAddTime(ProfileTimer timer, uint64_t nanoseconds)
+{
+    profile_current[timer].fetch_add(nanoseconds, std::memory_order_relaxed);
+}
+
+void ProfileFinishFrame(void)
+{
+    bool was_active = profile_active.load(std::memory_order_relaxed);
+    bool now_active = (debug_profile.d_ != 0 || abs(debug_fps.d_) >= 4);
+
+    profile_active.store(now_active, std::memory_order_relaxed);
+
+    uint64_t now = ProfileTimestamp();
+
+    if (was_active && profile_frame_start != 0)
+    {
+        ProfileFrame &frame = profile_history[profile_next];
+
+        frame.frame_time_ = (float)(now - profile_frame_start) / 1000000.0f;
+
+        for (int t = 0; t < kTotalProfileTimers; t++)
+            frame.timers_[t] = (float)profile_current[t].load(std::memory_order_relaxed) / 1000000.0f;
+
+        profile_next   = (profile_next + 1) % kProfileHistory;
+        profile_frames = HMM_MIN(profile_frames + 1, kProfileHistory);
+    }
+
+    for (int t = 0; t < kTotalProfileTimers; t++)
+        profile_current[t].store(0, std::memory_order_relaxed);
+
+    profile_frame_start = now_active ? now : 0;
+}
+
+// index into the history of the n-th oldest frame
+static const ProfileFrame &ProfileGetFrame(int n)
+{
+    return profile_history[(profile_next - profile_frames + n + kProfileHistory) % kProfileHistory];
+}
+
+float ProfileAverage(int timer, int frames)
+{
+    frames = HMM_MIN(frames, profile_frames);
+
+    if (frames <= 0)
+        return 0;
+
+    double total = 0;
+
+    for (int n = profile_frames - frames; n < profile_frames; n++)
+    {
+        const ProfileFrame &frame = ProfileGetFrame(n);
+
+        total += (timer < 0) ? frame.frame_time_ : frame.timers_[timer];
+    }
+
+    return (float)(total / frames);
+}
+
+const char *ProfileTimerName(int timer)
+{
+    if (timer < 0)
+        return "frame";
+
+    return profile_timer_names[timer];
+}
+
+bool ProfileDump(const char *filename)
+{
+    bool json = epi::StringCaseCompareASCII(epi::GetExtension(filename), ".json") == 0;
+
+    FILE *fp = epi::FileOpenRaw(filename, epi::kFileAccessWrite);
+    if (!fp)
+        return false;
+
+    if (json)
+    {
+        fprintf(fp, "{\n  \"frames\": [\n");
+
+        for (int n = 0; n < profile_frames; n++)
+        {
+            const ProfileFrame &frame = ProfileGetFrame(n);
+
+            fprintf(fp, "    {\"frame_ms\": %.4f", frame.frame_time_);
+
+            for (int t = 0; t < kTotalProfileTimers; t++)
+                fprintf(fp, ", \"%s_ms\": %.4f", profile_timer_names[t], frame.timers_[t]);
+
+            fprintf(fp, "}%s\n", (n + 1 < profile_frames) ? "," : "");
+        }
+
+        fprintf(fp, "  ]\n}\n");
+    }
+    else
+    {
+        fprintf(fp, "frame,frame_ms");
+
+        for (int t = 0; t < kTotalProfileTimers; t++)
+            fprintf(fp, ",%s_ms", profile_timer_names[t]);
+
+        fprintf(fp, "\n");
+
+        for (int n = 0; n < profile_frames; n++)
+        {
+            const ProfileFrame &frame = ProfileGetFrame(n);
+
+            fprintf(fp, "%d,%.4f", n, frame.frame_time_);
+
+            for (int t = 0; t < kTotalProfileTimers; t++)
+                fprintf(fp, ",%.4f", frame.timers_[t]);
+
+            fprintf(fp, "\n");
+        }
+    }
+
+    fclose(fp);
+
+    return true;
+}
+
+//--- editor settings ---
+// vi:ts=4:sw=4:noexpandtab
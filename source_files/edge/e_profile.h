@@ -0,0 +1,94 @@
+//----------------------------------------------------------------------------
+//  EDGE Built-in Frame Profiler
+//----------------------------------------------------------------------------
+//
+//  Copyright (c) 2024 The EDGE Team.
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation; either version 3
+//  of the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//----------------------------------------------------------------------------
+//
+//  A few coarse timers per frame, kept for the last few hundred frames
+//  so they can be shown with `debug_fps 4' and saved with the
+//  "profiledump" console command.  Unlike the Tracy zones this is
+//  always compiled in; when not recording, a timer costs one test of
+//  profile_active.
+//
+//  Timers are inclusive (the Lua HUD draws the world, so its time
+//  contains the BSP walk and unit rendering), and may be hit from
+//  other threads (sound mixing runs in the audio callback).
+//
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+enum ProfileTimer
+{
+    kProfileTimerBSPWalk = 0,
+    kProfileTimerRenderUnits,
+    kProfileTimerThinkers,
+    kProfileTimerSight,
+    kProfileTimerSoundMixing,
+    kProfileTimerLuaHUD,
+    kProfileTimerRTS,
+    kTotalProfileTimers
+};
+
+// number of frames kept
+constexpr int kProfileHistory = 256;
+
+// read by the audio thread too
+extern std::atomic<bool> profile_active;
+
+uint64_t ProfileTimestamp(void);
+void     ProfileAddTime(ProfileTimer timer, uint64_t nanoseconds);
+
+// called once per displayed frame, before the page flip
+void ProfileFinishFrame(void);
+
+// average milliseconds over the last `frames' frames (or as many as
+// have been recorded).  timer -1 gives the whole frame.
+float ProfileAverage(int timer, int frames);
+
+const char *ProfileTimerName(int timer);
+
+// writes the history as CSV, or as JSON when the name ends in .json
+bool ProfileDump(const char *filename);
+
+class ProfileScope
+{
+  private:
+    ProfileTimer timer_;
+    uint64_t     start_;
+
+  public:
+    ProfileScope(ProfileTimer timer)
+        : timer_(timer), start_(profile_active.load(std::memory_order_relaxed) ? ProfileTimestamp() : 0)
+    {
+    }
+
+    ~ProfileScope()
+    {
+        if (start_ != 0)
+            ProfileAddTime(timer_, ProfileTimestamp() - start_);
+    }
+};
+
+#define EDGE_ProfileConcat2(a, b) a##b
+#define EDGE_ProfileConcat(a, b)  EDGE_ProfileConcat2(a, b)
+
+#define EDGE_ProfileScope(timer) ProfileScope EDGE_ProfileConcat(profile_scope_, __LINE__)(timer)
+
+//--- editor settings ---
+// vi:ts=4:sw=4:noexpandtab
@@ -796,7 +796,9 @@ static bool GameLoadGameFromFile(std::string filename, bool is_hub)
     DDFBoomClearGeneralizedTypes();
 
     if (LoadAllSaveChunks() && SaveGetError() == 0)
-    { /* all went well */
+    {
+        // all went well, the automap has to be redrawn from what was loaded
+        automap_changes++;
     }
     else
     {
@@ -852,6 +852,41 @@ void HUDSolidLine(float x1, float y1, float x2, float y2, RGBAColor col, float t
     glLineWidth(1.0f);
 }
 
+void HUDSolidLines(const float *coords, int total, RGBAColor col, float thickness, bool smooth, float dx, float dy)
+{
+    if (total <= 0)
+        return;
+
+    dx = HUDToRealCoordinatesX(dx) - HUDToRealCoordinatesX(0);
+    dy = HUDToRealCoordinatesY(0) - HUDToRealCoordinatesY(dy);
+
+    glLineWidth(thickness);
+
+    if (smooth)
+        glEnable(GL_LINE_SMOOTH);
+
+    if (smooth || current_alpha < 0.99f)
+        glEnable(GL_BLEND);
+
+    sg_color sgcol = sg_make_color_1i(col);
+
+    glColor4f(sgcol.r, sgcol.g, sgcol.b, current_alpha);
+
+    glBegin(GL_LINES);
+
+    for (int i = 0; i < total; i++, coords += 4)
+    {
+        glVertex2i((int)HUDToRealCoordinatesX(coords[0]) + (int)dx, (int)HUDToRealCoordinatesY(coords[1]) + (int)dy);
+        glVertex2i((int)HUDToRealCoordinatesX(coords[2]) + (int)dx, (int)HUDToRealCoordinatesY(coords[3]) + (int)dy);
+    }
+
+    glEnd();
+
+    glDisable(GL_BLEND);
+    glDisable(GL_LINE_SMOOTH);
+    glLineWidth(1.0f);
+}
+
 void HUDThinBox(float x1, float y1, float x2, float y2, RGBAColor col, float thickness)
 {
     std::swap(y1, y2);
@@ -74,6 +74,11 @@ void HUDSolidBox(float x1, float y1, float x2, float y2, RGBAColor col);
 void HUDSolidLine(float x1, float y1, float x2, float y2, RGBAColor col, float thickness = 1, bool smooth = true,
                   float dx = 0, float dy = 0);
 
+// Like HUDSolidLine, but draws `total' lines of one colour at once,
+// `coords' holding x1, y1, x2, y2 for each of them.
+void HUDSolidLines(const float *coords, int total, RGBAColor col, float thickness = 1, bool smooth = true,
+                   float dx = 0, float dy = 0);
+
 // Draw a thin outline of a box.
 void HUDThinBox(float x1, float y1, float x2, float y2, RGBAColor col, float thickness = 0.0f);
 
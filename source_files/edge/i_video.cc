@@ -36,6 +36,7 @@
 #include "m_argv.h"
 #include "m_misc.h"
 #include "n_network.h"
+#include "p_tick.h"
 #include "r_modes.h"
 #include "version.h"
 
@@ -477,7 +478,17 @@ void FinishFrame(void)
     }
 
     if (uncapped_frames.d_)
-        fractional_tic = (float)(GetMilliseconds() * kTicRate % 1000) / 1000;
+    {
+        // measuring from the end of the last tic, rather than from the
+        // wall-clock phase, means a tic that ran late does not make
+        // things snap backwards for a frame.
+        float along = MapObjectTicFraction();
+
+        if (along >= 0)
+            fractional_tic = along;
+        else
+            fractional_tic = (float)(GetMilliseconds() * kTicRate % 1000) / 1000;
+    }
 
     if (vsync.CheckModified())
     {
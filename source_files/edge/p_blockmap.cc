@@ -44,6 +44,7 @@
 #include "r_misc.h"
 #include "r_shader.h"
 #include "r_state.h"
+#include "r_units.h"
 
 // FIXME: have a proper API
 extern AbstractShader *MakeDLightShader(MapObject *mo);
@@ -146,6 +147,28 @@ int touchstat_free;
 // FIXME: incorporate into FlushCaches
 TouchNode *free_touch_nodes;
 
+// touch nodes are carved out of blocks of this many, which are kept
+// for the life of the program (like the free list itself)
+static constexpr int kTouchNodeBlockSize = 512;
+
+static std::vector<TouchNode *> touch_node_blocks;
+
+static TouchNode *TouchNodeAllocBlock(void)
+{
+    TouchNode *block = new TouchNode[kTouchNodeBlockSize];
+
+    touch_node_blocks.push_back(block);
+
+    // the rest go on the free list, to be handed out in order
+    for (int i = kTouchNodeBlockSize - 1; i >= 1; i--)
+    {
+        block[i].map_object_next = free_touch_nodes;
+        free_touch_nodes         = &block[i];
+    }
+
+    return &block[0];
+}
+
 static inline TouchNode *TouchNodeAlloc(void)
 {
     TouchNode *tn;
@@ -161,7 +184,7 @@ static inline TouchNode *TouchNodeAlloc(void)
     }
     else
     {
-        tn = new TouchNode;
+        tn = TouchNodeAllocBlock();
     }
 
     return tn;
@@ -809,11 +832,48 @@ bool BlockmapThingIterator(float x1, float y1, float x2, float y2, bool (*func)(
     return true;
 }
 
+//
+// Looks at the same blocks as BlockmapLineIterator() and
+// BlockmapThingIterator() would, but only to see whether they hold
+// anything at all.  This is much cheaper than the full checks for
+// something (like a missile) crossing open space.
+//
+bool BlockmapAreaIsEmpty(float x1, float y1, float x2, float y2, MapObject *self)
+{
+    int line_lx = HMM_MAX(0, BlockmapGetX(x1));
+    int line_ly = HMM_MAX(0, BlockmapGetY(y1));
+    int line_hx = HMM_MIN(blockmap_width - 1, BlockmapGetX(x2));
+    int line_hy = HMM_MIN(blockmap_height - 1, BlockmapGetY(y2));
+
+    // the things are looked for one block further out
+    int lx = HMM_MAX(0, BlockmapGetX(x1) - 1);
+    int ly = HMM_MAX(0, BlockmapGetY(y1) - 1);
+    int hx = HMM_MIN(blockmap_width - 1, BlockmapGetX(x2) + 1);
+    int hy = HMM_MIN(blockmap_height - 1, BlockmapGetY(y2) + 1);
+
+    for (int by = ly; by <= hy; by++)
+        for (int bx = lx; bx <= hx; bx++)
+        {
+            int bnum = by * blockmap_width + bx;
+
+            MapObject *mo = blockmap_things[bnum];
+
+            if (mo != nullptr && (mo != self || mo->blockmap_next_ != nullptr))
+                return false;
+
+            // a block only gets a line list when a line is added
+            if (blockmap_lines[bnum] != nullptr && line_lx <= bx && bx <= line_hx && line_ly <= by && by <= line_hy)
+                return false;
+        }
+
+    return true;
+}
+
 void DynamicLightIterator(float x1, float y1, float z1, float x2, float y2, float z2, void (*func)(MapObject *, void *),
                           void *data)
 {
     EDGE_ZoneScoped;
-    ec_frame_stats.draw_light_iterator++;
+    UnitFrameStats().draw_light_iterator++;
 
     int lx = LightmapGetX(x1) - 1;
     int ly = LightmapGetY(y1) - 1;
@@ -847,6 +907,10 @@ void DynamicLightIterator(float x1, float y1, float z1, float x2, float y2, floa
                     mo->z - r >= z2)
                     continue;
 
+                // lit geometry is built on the main thread
+                if (UnitRecordingHazard())
+                    return;
+
                 // create shader if necessary
                 if (!mo->dynamic_light_.shader)
                     mo->dynamic_light_.shader = MakeDLightShader(mo);
@@ -872,7 +936,7 @@ void SectorGlowIterator(Sector *sec, float x1, float y1, float z1, float x2, flo
                         void (*func)(MapObject *, void *), void *data)
 {
     EDGE_ZoneScoped;
-    ec_frame_stats.draw_sector_glow_iterator++;
+    UnitFrameStats().draw_sector_glow_iterator++;
 
     for (MapObject *mo = sec->glow_things; mo; mo = mo->dynamic_light_next_)
     {
@@ -894,6 +958,9 @@ void SectorGlowIterator(Sector *sec, float x1, float y1, float z1, float x2, flo
         if (mo->info_->glow_type_ == kSectorGlowTypeCeiling && sec->ceiling_height - r >= z1)
             continue;
 
+        if (UnitRecordingHazard())
+            return;
+
         // create shader if necessary
         if (!mo->dynamic_light_.shader)
         {
@@ -1017,6 +1084,7 @@ static inline void PIT_AddLineIntercept(Line *ld)
     in.along = along;
     in.thing = nullptr;
     in.line  = ld;
+    in.order = (int)intercepts.size();
 
     intercepts.push_back(in);
 }
@@ -1082,15 +1150,20 @@ static inline void PIT_AddThingIntercept(MapObject *thing)
     in.along = along;
     in.thing = thing;
     in.line  = nullptr;
+    in.order = (int)intercepts.size();
 
     intercepts.push_back(in);
 }
 
+// for a heap with the nearest intercept on top
 struct Compare_Intercept_pred
 {
     inline bool operator()(const PathIntercept &A, const PathIntercept &B) const
     {
-        return A.along < B.along;
+        if (A.along != B.along)
+            return A.along > B.along;
+
+        return A.order > B.order;
     }
 };
 
@@ -1234,18 +1307,23 @@ bool PathTraverse(float x1, float y1, float x2, float y2, int flags, bool (*func
         }
     }
 
-    // go through the sorted list
+    // go through the intercepts, nearest first.  Most traversers stop
+    // at the first wall or thing they hit, so rather than sorting the
+    // whole list they are taken off a heap one at a time.
 
     if (intercepts.size() == 0)
         return true;
 
-    std::sort(intercepts.begin(), intercepts.end(), Compare_Intercept_pred());
+    std::make_heap(intercepts.begin(), intercepts.end(), Compare_Intercept_pred());
 
-    std::vector<PathIntercept>::iterator I;
+    std::vector<PathIntercept>::iterator heap_end = intercepts.end();
 
-    for (I = intercepts.begin(); I != intercepts.end(); I++)
+    while (heap_end != intercepts.begin())
     {
-        if (!func(&*I, data))
+        std::pop_heap(intercepts.begin(), heap_end, Compare_Intercept_pred());
+        heap_end--;
+
+        if (!func(&*heap_end, data))
         {
             // don't bother going further
             return false;
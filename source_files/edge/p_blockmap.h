@@ -68,6 +68,8 @@ struct PathIntercept
     // one of these will be nullptr
     MapObject *thing;
     Line      *line;
+    // order found, for equal `along' values
+    int order;
 };
 
 extern DividingLine trace;
@@ -91,6 +93,9 @@ bool BlockmapLineIterator(float x1, float y1, float x2, float y2, bool (*func)(L
 bool BlockmapThingIterator(float x1, float y1, float x2, float y2, bool (*func)(MapObject *, void *),
                            void *data = nullptr);
 
+// true when neither iterator above would find anything (besides `self')
+bool BlockmapAreaIsEmpty(float x1, float y1, float x2, float y2, MapObject *self);
+
 void DynamicLightIterator(float x1, float y1, float z1, float x2, float y2, float z2, void (*func)(MapObject *, void *),
                           void *data = nullptr);
 
@@ -26,6 +26,7 @@
 // -KM- 1998/09/27 Lights generalised for ddf
 //
 
+#include <algorithm>
 #include <list>
 #include <vector>
 
@@ -38,6 +39,37 @@
 
 std::vector<LightSpecial *> active_lights;
 
+//
+// Most lights only change every few tics, so rather than counting each
+// one down every tic, they sleep in a queue ordered by the tic of their
+// next change.  Lights due on the same tic run in the order of
+// active_lights, as before, keeping the random numbers in step.
+//
+class LightWakeup
+{
+  public:
+    int wake_tic;
+    int index;
+};
+
+class LightWakeupLater
+{
+  public:
+    bool operator()(const LightWakeup &a, const LightWakeup &b) const
+    {
+        if (a.wake_tic != b.wake_tic)
+            return a.wake_tic > b.wake_tic;
+
+        return a.index > b.index;
+    }
+};
+
+// a min-heap
+static std::vector<LightWakeup> light_queue;
+
+// number of RunLights() calls so far
+static int light_clock = 0;
+
 //
 // GENERALISED LIGHT
 //
@@ -247,6 +279,52 @@ void DestroyAllLights(void)
     }
 
     active_lights.clear();
+    light_queue.clear();
+}
+
+//
+// Queues the light for its next change, after `count' more tics.
+// An older entry for the same light is left in the queue, it is
+// recognised as stale by its wake_tic no longer matching.
+//
+static void ScheduleLight(int index)
+{
+    LightSpecial *light = active_lights[index];
+
+    if (light->count <= 0 || light->type->type_ == kLightSpecialTypeNone)
+    {
+        light->wake_tic = 0;
+        return;
+    }
+
+    light->wake_tic = light_clock + light->count;
+
+    LightWakeup entry;
+
+    entry.wake_tic = light->wake_tic;
+    entry.index    = index;
+
+    light_queue.push_back(entry);
+    std::push_heap(light_queue.begin(), light_queue.end(), LightWakeupLater());
+}
+
+void ScheduleAllLights(void)
+{
+    light_queue.clear();
+
+    for (int i = 0; i < (int)active_lights.size(); i++)
+        ScheduleLight(i);
+}
+
+void UpdateLightCounts(void)
+{
+    std::vector<LightSpecial *>::iterator LI;
+
+    for (LI = active_lights.begin(); LI != active_lights.end(); LI++)
+    {
+        if ((*LI)->wake_tic > 0)
+            (*LI)->count = (*LI)->wake_tic - light_clock;
+    }
 }
 
 LightSpecial *NewLight(void)
@@ -263,15 +341,16 @@ LightSpecial *NewLight(void)
 bool RunSectorLight(Sector *sec, const LightSpecialDefinition *type)
 {
     // check if a light effect already is running on this sector.
+    // (the count of a sleeping light is stale, but never 0)
     LightSpecial *light = nullptr;
 
-    std::vector<LightSpecial *>::iterator LI;
+    int index;
 
-    for (LI = active_lights.begin(); LI != active_lights.end(); LI++)
+    for (index = 0; index < (int)active_lights.size(); index++)
     {
-        if ((*LI)->count == 0 || (*LI)->sector == sec)
+        if (active_lights[index]->count == 0 || active_lights[index]->sector == sec)
         {
-            light = *LI;
+            light = active_lights[index];
             break;
         }
     }
@@ -308,6 +387,8 @@ bool RunSectorLight(Sector *sec, const LightSpecialDefinition *type)
     }
     }
 
+    ScheduleLight(index);
+
     return true;
 }
 
@@ -321,11 +402,27 @@ bool RunSectorLight(Sector *sec, const LightSpecialDefinition *type)
 //
 void RunLights(void)
 {
-    std::vector<LightSpecial *>::iterator LI;
+    light_clock++;
 
-    for (LI = active_lights.begin(); LI != active_lights.end(); LI++)
+    while (!light_queue.empty() && light_queue.front().wake_tic <= light_clock)
     {
-        DoLight(*LI);
+        std::pop_heap(light_queue.begin(), light_queue.end(), LightWakeupLater());
+
+        LightWakeup entry = light_queue.back();
+        light_queue.pop_back();
+
+        LightSpecial *light = active_lights[entry.index];
+
+        if (light->wake_tic != entry.wake_tic)
+            continue;
+
+        // this is the tic its countdown reaches zero
+        light->count    = 1;
+        light->wake_tic = 0;
+
+        DoLight(light);
+
+        ScheduleLight(entry.index);
     }
 }
 
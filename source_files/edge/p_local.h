@@ -210,6 +210,7 @@ bool       CheckSolidSectorMove(Sector *sec, bool is_ceiling, float dh);
 bool       SolidSectorMove(Sector *sec, bool is_ceiling, float dh, int crush = 10, bool nocarething = false);
 bool       CheckAbsolutePosition(MapObject *thing, float x, float y, float z);
 bool       CheckSight(MapObject *src, MapObject *dest);
+void       ClearSightCache(void);
 bool       CheckSightToPoint(MapObject *src, float x, float y, float z);
 bool       QuickVerticalSightCheck(MapObject *src, MapObject *dest);
 void       RadiusAttack(MapObject *spot, MapObject *source, float radius, float damage, const DamageClass *damtype,
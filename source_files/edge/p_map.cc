@@ -40,6 +40,7 @@
 #include <float.h>
 
 #include "AlmostEquals.h"
+#include "am_map.h"
 #include "dm_defs.h"
 #include "dm_state.h"
 #include "epi.h"
@@ -1047,6 +1048,13 @@ static bool CheckRelativePosition(MapObject *thing, float x, float y)
 
     special_lines_hit.clear();
 
+    // a missile in open space: the checks below would find nothing
+    if ((move_check.flags & kMapObjectFlagMissile) && BlockmapAreaIsEmpty(x - r, y - r, x + r, y + r, thing))
+    {
+        thing->on_ladder_ = -1;
+        return true;
+    }
+
     // -KM- 1998/11/25 Corpses aren't supposed to hang in the air...
     if (!(move_check.flags & (kMapObjectFlagNoClip | kMapObjectFlagCorpse)))
     {
@@ -2967,6 +2975,8 @@ bool SolidSectorMove(Sector *sec, bool is_ceiling, float dh, int crush, bool noc
     else
         sec->floor_height += dh;
 
+    automap_changes++;
+
     RecomputeGapsAroundSector(sec);
     FloodExtraFloors(sec);
 
@@ -41,6 +41,7 @@
 #include <vector>
 
 #include "AlmostEquals.h"
+#include "con_var.h"
 #include "dm_defs.h"
 #include "dm_state.h"
 #include "epi.h"
@@ -50,6 +51,9 @@
 #include "p_spec.h"
 #include "r_state.h"
 
+// check the fast gap paths against a full rebuild
+EDGE_DEFINE_CONSOLE_VARIABLE(debug_gaps, "0", kConsoleVariableFlagCheat)
+
 extern unsigned int root_node;
 
 //
@@ -656,6 +660,49 @@ void ComputeGaps(Line *ld)
 
     // handle normal gaps ("movement" gaps)
 
+    // Without extrafloors each side is a single gap (liquids only
+    // matter for things), so the result is simply the overlap of the
+    // two sectors.  This is the usual case for moving lifts, doors and
+    // crushers, and gives exactly what the full code below does.
+    if (!front->bottom_extrafloor && !back->bottom_extrafloor)
+    {
+        ld->gap_number = 0;
+
+        if (front->floor_height < front->ceiling_height && back->floor_height < back->ceiling_height)
+        {
+            float f = HMM_MAX(back->floor_height, front->floor_height);
+            float c = HMM_MIN(back->ceiling_height, front->ceiling_height);
+
+            if (f < c)
+            {
+                ld->gaps[0].floor   = f;
+                ld->gaps[0].ceiling = c;
+                ld->gap_number      = 1;
+            }
+        }
+
+        if (!debug_gaps.d_)
+            return;
+
+        VerticalGap check_gaps[100];
+
+        int check_num = GapConstruct(check_gaps, front, nullptr);
+        temp_num      = GapConstruct(temp_gaps, back, nullptr);
+        check_num     = GapRestrict(check_gaps, check_num, temp_gaps, temp_num);
+
+        if (check_num != ld->gap_number ||
+            (check_num == 1 &&
+             (check_gaps[0].floor != ld->gaps[0].floor || check_gaps[0].ceiling != ld->gaps[0].ceiling)))
+        {
+            LogWarning("ComputeGaps: fast path mismatch on line %d\n", (int)(ld - level_lines));
+
+            memcpy(ld->gaps, check_gaps, check_num * sizeof(VerticalGap));
+            ld->gap_number = check_num;
+        }
+
+        return;
+    }
+
     ld->gap_number = GapConstruct(ld->gaps, front, nullptr);
     temp_num       = GapConstruct(temp_gaps, back, nullptr);
 
@@ -935,6 +982,15 @@ void RecomputeGapsAroundSector(Sector *sec)
         return;
     }
 
+    // nothing to cut out of the sector
+    if (!sec->bottom_extrafloor && !sec->bottom_liquid)
+    {
+        sec->sight_gaps[0].floor   = sec->floor_height;
+        sec->sight_gaps[0].ceiling = sec->ceiling_height;
+        sec->sight_gap_number      = 1;
+        return;
+    }
+
     sec->sight_gap_number = GapSightConstruct(sec->sight_gaps, sec);
 }
 
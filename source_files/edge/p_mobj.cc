@@ -57,6 +57,7 @@
 #include "con_main.h"
 #include "dm_defs.h"
 #include "dm_state.h"
+#include "e_profile.h"
 #include "epi.h"
 #include "f_interm.h"
 #include "g_game.h"
@@ -84,6 +85,9 @@ static constexpr float   kMaximumMove  = 200.0f;
 static constexpr float   kStepMove     = 16.0f;
 static constexpr uint8_t kRespawnDelay = (kTicRate / 2);
 
+// idle objects far from every player change state less often,
+// which mostly means they look for a target less often.  Changes how
+// the game plays out, so it must match for demos and net games.
 EDGE_DEFINE_CONSOLE_VARIABLE(distance_cull_thinkers, "0", kConsoleVariableFlagArchive)
 
 EDGE_DEFINE_CONSOLE_VARIABLE(gravity_factor, "1.0", kConsoleVariableFlagArchive)
@@ -1341,16 +1345,10 @@ static void P_ZMovement(MapObject *mo, const RegionProperties *props)
 }
 
 //
-// P_MobjThinker
+// The bookkeeping done at the start of every tic
 //
-static void P_MobjThinker(MapObject *mobj)
+static void P_MobjStartTic(MapObject *mobj)
 {
-    if (mobj->next_ == (MapObject *)-1)
-        FatalError("P_MobjThinker INTERNAL ERROR: mobj has been freed");
-
-    if (mobj->IsRemoved())
-        return;
-
     if (!(mobj->player_ != NULL && mobj == mobj->player_->map_object_))
     {
         // Assume we can interpolate at the beginning
@@ -1364,9 +1362,6 @@ static void P_MobjThinker(MapObject *mobj)
         mobj->old_angle_ = mobj->angle_;
     }
 
-    const RegionProperties *props;
-    RegionProperties        player_props;
-
     mobj->old_z_       = mobj->z;
     mobj->old_floor_z_ = mobj->floor_z_;
     mobj->on_slope_    = false;
@@ -1389,6 +1384,23 @@ static void P_MobjThinker(MapObject *mobj)
             mobj->interpolation_position_ = mobj->interpolation_number_ = 0;
         }
     }
+}
+
+//
+// P_MobjThinker
+//
+static void P_MobjThinker(MapObject *mobj)
+{
+    if (mobj->next_ == (MapObject *)-1)
+        FatalError("P_MobjThinker INTERNAL ERROR: mobj has been freed");
+
+    if (mobj->IsRemoved())
+        return;
+
+    P_MobjStartTic(mobj);
+
+    const RegionProperties *props;
+    RegionProperties        player_props;
 
     // handle SKULLFLY attacks
     if ((mobj->flags_ & kMapObjectFlagSkullFly) && AlmostEquals(mobj->momentum_.X, 0.0f) &&
@@ -1831,6 +1843,135 @@ void ClearRespawnQueue(void)
     }
 }
 
+//
+// An idle object -- at rest on the floor, without a target and with
+// nothing counting down -- only needs the start of tic bookkeeping and
+// its state counted down, so long as nothing pushes or hurts it.
+//
+static bool P_MobjIsIdle(const MapObject *mobj)
+{
+    if (mobj->player_ || mobj->target_ || (mobj->flags_ & (kMapObjectFlagSkullFly | kMapObjectFlagMissile)))
+        return false;
+
+    if (!AlmostEquals(mobj->momentum_.X, 0.0f) || !AlmostEquals(mobj->momentum_.Y, 0.0f) ||
+        !AlmostEquals(mobj->momentum_.Z, 0.0f) || !AlmostEquals(mobj->z, mobj->floor_z_))
+        return false;
+
+    if (mobj->fuse_ >= 0 || (mobj->health_ > 0 && mobj->morph_timeout_ >= 0))
+        return false;
+
+    // nightmare respawning counts the tics of a corpse
+    if (mobj->tics_ < 0 && (mobj->extended_flags_ & kExtendedFlagMonster) && level_flags.enemies_respawn &&
+        !(mobj->extended_flags_ & kExtendedFlagNoRespawn))
+        return false;
+
+    const RegionProperties *props = mobj->region_properties_;
+
+    if (props->special && props->special->damage_.grounded_monsters_)
+        return false;
+
+    for (TouchNode *tn = mobj->touch_sectors_; tn; tn = tn->map_object_next)
+    {
+        if (tn->sector)
+        {
+            const HMM_Vec3 &push = tn->sector->properties.push;
+
+            if (push.X || push.Y || push.Z)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+//
+// How many tics the state changes of an idle object may be put off,
+// by its distance to the nearest player.
+//
+static int P_MobjIdlePeriod(const MapObject *mobj)
+{
+    if (!distance_cull_thinkers.d_)
+        return 0;
+
+    float dist = 1.0e9f;
+
+    for (int pnum = 0; pnum < kMaximumPlayers; pnum++)
+    {
+        if (players[pnum] && players[pnum]->map_object_)
+        {
+            const MapObject *pmo = players[pnum]->map_object_;
+
+            dist = HMM_MIN(dist, ApproximateDistance(pmo->x - mobj->x, pmo->y - mobj->y));
+        }
+    }
+
+    if (dist < 2048.0f)
+        return 0;
+    if (dist < 4096.0f)
+        return 16;
+    if (dist < 8192.0f)
+        return 32;
+
+    return 64;
+}
+
+//
+// Runs the tic of an idle object without the full thinker.  This does
+// exactly what P_MobjThinker() would, except that with
+// distance_cull_thinkers a state change may be put off until the
+// object's wake tic.  Those are the only tics where behaviour differs.
+// The choice depends on the players' positions, but also on the local
+// distance_cull_thinkers setting, so the mode is NOT deterministic
+// across machines: demos and net games only stay in sync when every
+// side uses the same setting.
+//
+// Returns false when the full thinker is needed.
+//
+static bool P_MobjIdleThink(MapObject *mobj)
+{
+    if (!P_MobjIsIdle(mobj))
+        return false;
+
+    bool count_down = (mobj->tics_ >= 0);
+    int  tics       = mobj->tics_;
+
+    if (count_down)
+    {
+        if (level_flags.fast_monsters)
+            tics -= (1 * mobj->info_->fast_ + mobj->tic_skip_);
+        else
+            tics -= (1 + mobj->tic_skip_);
+
+        if (tics < 1)
+        {
+            if (level_time_elapsed >= mobj->think_wake_tic_)
+            {
+                mobj->think_wake_tic_ = level_time_elapsed + P_MobjIdlePeriod(mobj);
+                return false;
+            }
+
+            // hold the state until the wake tic
+            count_down = false;
+        }
+    }
+
+    P_MobjStartTic(mobj);
+
+    if (mobj->subsector_->sector->floor_vertex_slope)
+    {
+        if (AlmostEquals(mobj->old_z_, mobj->old_floor_z_))
+            mobj->on_slope_ = true;
+    }
+
+    if (count_down)
+    {
+        mobj->tics_     = tics;
+        mobj->tic_skip_ = 0;
+    }
+
+    return true;
+}
+
 //
 // RunMobjThinkers
 //
@@ -1839,6 +1980,8 @@ void ClearRespawnQueue(void)
 //
 void RunMapObjectThinkers()
 {
+    EDGE_ProfileScope(kProfileTimerThinkers);
+
     MapObject *mo;
     MapObject *next;
 
@@ -1878,12 +2021,7 @@ void RunMapObjectThinkers()
         {
             if (time_stop_active)
                 continue;
-            if (!distance_cull_thinkers.d_ ||
-                (game_tic / 2 %
-                     RoundToInteger(1 + PointToDistance(players[console_player]->map_object_->x,
-                                                        players[console_player]->map_object_->y, mo->x, mo->y) /
-                                            1500) ==
-                 0))
+            if (!P_MobjIdleThink(mo))
                 P_MobjThinker(mo);
         }
     }
@@ -240,6 +240,10 @@ class MapObject : public Position
     int tics_     = 0;
     int tic_skip_ = 0;
 
+    // when idle and far from the players, state changes are put off
+    // until this level tic (see distance_cull_thinkers)
+    int think_wake_tic_ = 0;
+
     const struct State *state_      = nullptr;
     const struct State *next_state_ = nullptr;
 
@@ -23,9 +23,12 @@
 //
 //----------------------------------------------------------------------------
 
+#include <limits.h>
+
 #include <algorithm>
 
 #include "AlmostEquals.h"
+#include "am_map.h"
 #include "dm_defs.h"
 #include "dm_state.h"
 #include "epi.h"
@@ -56,6 +59,11 @@ extern std::vector<LineAnimation>   line_animations;
 LineType   donut[2];
 static int donut_setup = 0;
 
+// number of RunActivePlanes() and RunActiveSliders() calls so far,
+// for waking up the movers which are just waiting
+static int plane_clock  = 0;
+static int slider_clock = 0;
+
 static bool P_ActivateInStasis(int tag);
 static bool P_StasifySector(int tag);
 
@@ -208,6 +216,61 @@ void DestroyAllSliders(void)
     active_sliders.clear();
 }
 
+//
+// A mover which spent a whole tic waiting (or in stasis) has nothing to
+// do until its wait runs out, so it is skipped until then.  One tic in
+// the state first makes sure the interpolation heights have settled.
+//
+static void SleepPlane(PlaneMover *pmov)
+{
+    if (pmov->direction == kPlaneDirectionStasis)
+        pmov->wake_tic = INT_MAX;
+    else if (pmov->direction == kPlaneDirectionWait && pmov->waited > 1)
+        pmov->wake_tic = plane_clock + pmov->waited;
+}
+
+static void WakePlane(PlaneMover *pmov)
+{
+    if (pmov->wake_tic == 0)
+        return;
+
+    if (pmov->direction == kPlaneDirectionWait)
+        pmov->waited = pmov->wake_tic - plane_clock;
+
+    pmov->wake_tic = 0;
+}
+
+void WakeAllPlanes(void)
+{
+    std::vector<PlaneMover *>::iterator PMI;
+
+    for (PMI = active_planes.begin(); PMI != active_planes.end(); PMI++)
+        WakePlane(*PMI);
+}
+
+static void SleepSlider(SlidingDoorMover *smov)
+{
+    if (smov->direction == kPlaneDirectionWait && smov->waited > 1)
+        smov->wake_tic = slider_clock + smov->waited;
+}
+
+static void WakeSlider(SlidingDoorMover *smov)
+{
+    if (smov->wake_tic == 0)
+        return;
+
+    smov->waited   = smov->wake_tic - slider_clock;
+    smov->wake_tic = 0;
+}
+
+void WakeAllSliders(void)
+{
+    std::vector<SlidingDoorMover *>::iterator SMI;
+
+    for (SMI = active_sliders.begin(); SMI != active_sliders.end(); SMI++)
+        WakeSlider(*SMI);
+}
+
 //
 // FLOORS
 //
@@ -1042,6 +1105,13 @@ bool RunManualPlaneMover(Line *line, MapObject *thing, const PlaneMoverDefinitio
         if (def->type_ == kPlaneMoverMoveWaitReturn)
         {
             int newdir;
+
+            // a door waiting to close may be asleep, it must move on the
+            // very next tic once its direction changes.
+            WakePlane(pmov);
+
+            EPI_ASSERT(pmov->wake_tic == 0);
+
             int olddir = pmov->direction;
 
             // only players close doors
@@ -1077,6 +1147,8 @@ static bool P_ActivateInStasis(int tag)
 
         if (pmov->direction == kPlaneDirectionStasis && pmov->tag == tag)
         {
+            WakePlane(pmov);
+
             pmov->direction = pmov->old_direction;
             result          = true;
         }
@@ -1097,6 +1169,8 @@ static bool P_StasifySector(int tag)
 
         if (pmov->direction != kPlaneDirectionStasis && pmov->tag == tag)
         {
+            WakePlane(pmov);
+
             pmov->old_direction = pmov->direction;
             pmov->direction     = kPlaneDirectionStasis;
 
@@ -1268,6 +1342,8 @@ static bool MoveSlider(SlidingDoorMover *smov)
                 ld->slide_door = nullptr;
                 ld->special    = nullptr;
 
+                automap_changes++;
+
                 // clear the side textures
                 ld->side[0]->middle.image = nullptr;
                 ld->side[1]->middle.image = nullptr;
@@ -1321,6 +1397,8 @@ static bool MoveSlider(SlidingDoorMover *smov)
                     ld->slide_door = nullptr;
                     ld->special    = nullptr;
 
+                    automap_changes++;
+
                     // clear the side textures
                     ld->side[0]->middle.image = nullptr;
                     ld->side[1]->middle.image = nullptr;
@@ -1361,7 +1439,8 @@ bool RunSlidingDoor(Line *door, Line *act_line, MapObject *thing, const LineType
         // only players close doors
         if (smov->direction == kPlaneDirectionWait && thing && thing->player_)
         {
-            smov->waited = 0;
+            smov->waited   = 0;
+            smov->wake_tic = 0;
             return true;
         }
 
@@ -1416,11 +1495,30 @@ void RunActivePlanes(void)
 
     bool removed_plane = false;
 
+    plane_clock++;
+
     for (PMI = active_planes.begin(); PMI != active_planes.end(); PMI++)
     {
         PlaneMover *pmov = *PMI;
 
-        if (MovePlane(pmov))
+        if (pmov->wake_tic > plane_clock)
+            continue;
+
+        // this is the tic its wait runs out
+        if (pmov->wake_tic != 0)
+        {
+            pmov->waited   = 1;
+            pmov->wake_tic = 0;
+        }
+
+        int direction = pmov->direction;
+
+        if (!MovePlane(pmov))
+        {
+            if (pmov->direction == direction)
+                SleepPlane(pmov);
+        }
+        else
         {
             // Make BOOM scroller effects permanent as this pmov will never be
             // recreated
@@ -1615,11 +1713,29 @@ void RunActiveSliders(void)
 
     bool removed_slider = false;
 
+    slider_clock++;
+
     for (SMI = active_sliders.begin(); SMI != active_sliders.end(); SMI++)
     {
         SlidingDoorMover *smov = *SMI;
 
-        if (MoveSlider(smov))
+        if (smov->wake_tic > slider_clock)
+            continue;
+
+        if (smov->wake_tic != 0)
+        {
+            smov->waited   = 1;
+            smov->wake_tic = 0;
+        }
+
+        int direction = smov->direction;
+
+        if (!MoveSlider(smov))
+        {
+            if (smov->direction == direction)
+                SleepSlider(smov);
+        }
+        else
         {
             smov->line->slider_move = nullptr;
 
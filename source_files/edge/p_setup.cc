@@ -269,7 +269,6 @@ static void CheckDoom2Map05Bug(uint8_t *data, int length)
 
 static void LoadVertexes(int lump)
 {
-    const uint8_t   *data;
     int              i;
     const RawVertex *ml;
     Vertex          *li;
@@ -287,9 +286,9 @@ static void LoadVertexes(int lump)
     level_vertexes = new Vertex[total_level_vertexes];
 
     // Load data into cache.
-    data = LoadLumpIntoMemory(lump);
+    LumpView data(lump);
 
-    ml = (const RawVertex *)data;
+    ml = (const RawVertex *)data.GetData();
     li = level_vertexes;
 
     int min_x = 0;
@@ -314,9 +313,6 @@ static void LoadVertexes(int lump)
     GenerateBlockmap(min_x, min_y, max_x, max_y);
 
     CreateThingBlockmap();
-
-    // Free buffer memory.
-    delete[] data;
 }
 
 static void SegCommonStuff(Seg *seg, int linedef_in)
@@ -905,11 +901,11 @@ static void LoadLineDefs(int lump)
 
     temp_line_sides = new int[total_level_lines * 2];
 
-    const uint8_t *data = LoadLumpIntoMemory(lump);
-    map_lines_crc.AddBlock((const uint8_t *)data, GetLumpLength(lump));
+    LumpView data(lump);
+    map_lines_crc.AddBlock(data.GetData(), data.GetSize());
 
     Line             *ld  = level_lines;
-    const RawLinedef *mld = (const RawLinedef *)data;
+    const RawLinedef *mld = (const RawLinedef *)data.GetData();
 
     for (int i = 0; i < total_level_lines; i++, mld++, ld++)
     {
@@ -966,8 +962,6 @@ static void LoadLineDefs(int lump)
 
         BlockmapAddLine(ld);
     }
-
-    delete[] data;
 }
 
 static Sector *DetermineSubsectorSector(Subsector *ss, int pass)
@@ -1072,23 +1066,19 @@ static void AssignSubsectorsToSectors()
 // is all our built-in AJBSP produces now
 static void LoadXGL3Nodes(int lumpnum)
 {
-    int                  i, xglen = 0;
-    uint8_t             *xgldata = nullptr;
+    int                  i;
     std::vector<uint8_t> zgldata;
-    uint8_t             *td = nullptr;
+    const uint8_t       *td = nullptr;
 
     LogDebug("LoadXGL3Nodes:\n");
 
-    xglen   = GetLumpLength(lumpnum);
-    xgldata = (uint8_t *)LoadLumpIntoMemory(lumpnum);
-    if (!xgldata)
-        FatalError("LoadXGL3Nodes: Couldn't load lump\n");
+    LumpView xgl_view(lumpnum);
+
+    const uint8_t *xgldata = xgl_view.GetData();
+    int            xglen   = xgl_view.GetSize();
 
     if (xglen < 12)
-    {
-        delete[] xgldata;
         FatalError("LoadXGL3Nodes: Lump too short\n");
-    }
 
     if (!memcmp(xgldata, "XGL3", 4))
         LogDebug(" AJBSP uncompressed GL nodes v3\n");
@@ -1127,8 +1117,7 @@ static void LoadXGL3Nodes(int lumpnum)
     else
     {
         static char xgltemp[6];
-        epi::CStringCopyMax(xgltemp, (char *)xgldata, 4);
-        delete[] xgldata;
+        epi::CStringCopyMax(xgltemp, (const char *)xgldata, 4);
         FatalError("LoadXGL3Nodes: Unrecognized node type %s\n", xgltemp);
     }
 
@@ -1143,7 +1132,6 @@ static void LoadXGL3Nodes(int lumpnum)
     td += 4;
     if (oVerts > total_level_vertexes)
     {
-        delete[] xgldata;
         FatalError("LoadXGL3Nodes: Vertex/Node mismatch\n");
     }
 
@@ -1172,7 +1160,6 @@ static void LoadXGL3Nodes(int lumpnum)
     td += 4;
     if (total_level_subsectors <= 0)
     {
-        delete[] xgldata;
         FatalError("LoadXGL3Nodes: No subsectors\n");
     }
     LogDebug("LoadXGL3Nodes: Num SSECTORS = %d\n", total_level_subsectors);
@@ -1195,7 +1182,6 @@ static void LoadXGL3Nodes(int lumpnum)
     td += 4;
     if (total_level_segs != xglSegs)
     {
-        delete[] xgldata;
         FatalError("LoadXGL3Nodes: Incorrect number of segs in nodes\n");
     }
     LogDebug("LoadXGL3Nodes: Num SEGS = %d\n", total_level_segs);
@@ -1349,7 +1335,6 @@ static void LoadXGL3Nodes(int lumpnum)
     SetupRootNode();
 
     LogDebug("LoadXGL3Nodes: Finished\n");
-    delete[] xgldata;
     zgldata.clear();
 }
 
@@ -2623,7 +2608,6 @@ static void TransferMapSideDef(const RawSidedef *msd, Side *sd, bool two_sided)
 static void LoadSideDefs(int lump)
 {
     int               i;
-    const uint8_t    *data;
     const RawSidedef *msd;
     Side             *sd;
 
@@ -2641,8 +2625,8 @@ static void LoadSideDefs(int lump)
 
     EPI_CLEAR_MEMORY(level_sides, Side, total_level_sides);
 
-    data = LoadLumpIntoMemory(lump);
-    msd  = (const RawSidedef *)data;
+    LumpView data(lump);
+    msd = (const RawSidedef *)data.GetData();
 
     sd = level_sides;
 
@@ -2686,8 +2670,6 @@ static void LoadSideDefs(int lump)
     }
 
     EPI_ASSERT(sd == level_sides + total_level_sides);
-
-    delete[] data;
 }
 
 //
@@ -3356,6 +3338,7 @@ void ShutdownLevel(void)
     level_segs = nullptr;
     delete[] level_nodes;
     level_nodes = nullptr;
+    DestroySubsectorGrid();
     delete[] level_vertexes;
     level_vertexes = nullptr;
     delete[] level_sides;
@@ -3434,14 +3417,10 @@ void LevelSetup(void)
     {
         udmf_level          = true;
         udmf_lump_number    = lumpnum + 1;
-        int      raw_length = 0;
-        uint8_t *raw_udmf   = LoadLumpIntoMemory(udmf_lump_number, &raw_length);
-        udmf_lump.clear();
-        udmf_lump.resize(raw_length);
-        memcpy(udmf_lump.data(), raw_udmf, raw_length);
+        LumpView raw_udmf(udmf_lump_number);
+        udmf_lump.assign(raw_udmf.GetString());
         if (udmf_lump.empty())
             FatalError("Internal error: can't load UDMF lump.\n");
-        delete[] raw_udmf;
     }
     else
     {
@@ -3496,6 +3475,8 @@ void LevelSetup(void)
 
     LoadXGL3Nodes(xgl_lump);
 
+    CreateSubsectorGrid();
+
     GroupLines();
 
     DetectDeepWaterTrick();
@@ -3534,6 +3515,8 @@ void LevelSetup(void)
 
     SpawnMapSpecials2(current_map->autotag_);
 
+    ClearSightCache();
+
     AutomapInitLevel();
 
     UpdateSkyboxTextures();
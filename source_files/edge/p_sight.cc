@@ -34,6 +34,13 @@
 //  lines blocking view) then we use the intercept list to check for
 //  extrafloors that block the view.
 //
+//  Which side of a BSP divider or linedef each end of the LOS ray is
+//  on does not depend on the other end, so these are remembered for
+//  the last few points looked from or at.  Most of the checks in a tic
+//  share one end (the monsters looking for a player, an explosion
+//  finding what it can reach, the listener hearing sounds), and that
+//  end only needs placing against each divider once.
+//
 
 #include <math.h>
 
@@ -41,6 +48,7 @@
 
 #include "AlmostEquals.h"
 #include "dm_defs.h"
+#include "e_profile.h"
 #include "epi.h"
 #include "epi_doomdefs.h"
 #include "m_bbox.h"
@@ -52,6 +60,30 @@
 
 extern unsigned int root_node;
 
+class SightPointCache
+{
+  public:
+    float x_;
+    float y_;
+
+    // 0 when unused, otherwise unique to this point
+    uint32_t epoch_;
+    uint32_t last_used_;
+
+    // a side is valid when its epoch matches
+    std::vector<uint32_t> node_epochs_;
+    std::vector<uint8_t>  node_sides_;
+    std::vector<uint32_t> line_epochs_;
+    std::vector<uint8_t>  line_sides_;
+};
+
+static constexpr uint8_t kSightPointCaches = 4;
+
+static SightPointCache sight_caches[kSightPointCaches];
+
+static uint32_t sight_cache_epoch = 0;
+static uint32_t sight_cache_use   = 0;
+
 struct LineOfSight
 {
     // source position (dx/dy is vector to dest)
@@ -85,10 +117,103 @@ struct LineOfSight
 
     // true if one of the sectors contained vertex slopes
     bool saw_vertex_slopes;
+
+    // sides remembered for each end
+    SightPointCache *source_cache;
+    SightPointCache *destination_cache;
 };
 
 static LineOfSight sight_check;
 
+void ClearSightCache(void)
+{
+    sight_cache_epoch = 0;
+    sight_cache_use   = 0;
+
+    for (int i = 0; i < kSightPointCaches; i++)
+    {
+        SightPointCache &cache = sight_caches[i];
+
+        cache.epoch_     = 0;
+        cache.last_used_ = 0;
+
+        cache.node_epochs_.assign(total_level_nodes, 0);
+        cache.node_sides_.resize(total_level_nodes);
+        cache.line_epochs_.assign(total_level_lines, 0);
+        cache.line_sides_.resize(total_level_lines);
+    }
+}
+
+static SightPointCache *GetSightPointCache(float x, float y)
+{
+    SightPointCache *oldest = &sight_caches[0];
+
+    sight_cache_use++;
+
+    for (int i = 0; i < kSightPointCaches; i++)
+    {
+        SightPointCache *cache = &sight_caches[i];
+
+        if (cache->epoch_ != 0 && cache->x_ == x && cache->y_ == y)
+        {
+            cache->last_used_ = sight_cache_use;
+            return cache;
+        }
+
+        if (cache->last_used_ < oldest->last_used_)
+            oldest = cache;
+    }
+
+    // SightUseCaches makes sure the epochs cannot run out here
+    EPI_ASSERT(sight_cache_epoch < UINT32_MAX);
+
+    oldest->x_         = x;
+    oldest->y_         = y;
+    oldest->epoch_     = ++sight_cache_epoch;
+    oldest->last_used_ = sight_cache_use;
+
+    return oldest;
+}
+
+static inline int SightNodeSide(SightPointCache *cache, unsigned int bspnum)
+{
+    if (cache->node_epochs_[bspnum] != cache->epoch_)
+    {
+        cache->node_epochs_[bspnum] = cache->epoch_;
+        cache->node_sides_[bspnum]  = PointOnDividingLineSide(cache->x_, cache->y_, &level_nodes[bspnum].divider);
+    }
+
+    return cache->node_sides_[bspnum];
+}
+
+static inline int SightLineSide(SightPointCache *cache, Line *ld, DividingLine *divl)
+{
+    int index = ld - level_lines;
+
+    if (cache->line_epochs_[index] != cache->epoch_)
+    {
+        cache->line_epochs_[index] = cache->epoch_;
+        cache->line_sides_[index]  = PointOnDividingLineSide(cache->x_, cache->y_, divl);
+    }
+
+    return cache->line_sides_[index];
+}
+
+// looks up the caches for both ends of sight_check
+static void SightUseCaches(void)
+{
+    // start again with nothing remembered when the level has changed
+    // size since the last clear, or when the epochs could run out during
+    // the two lookups below (clearing between them would make the first
+    // cache look valid while it holds stale sides).
+    if ((int)sight_caches[0].node_epochs_.size() != total_level_nodes ||
+        (int)sight_caches[0].line_epochs_.size() != total_level_lines || sight_cache_epoch > UINT32_MAX - 2)
+        ClearSightCache();
+
+    sight_check.source_cache      = GetSightPointCache(sight_check.source.x, sight_check.source.y);
+    sight_check.destination_cache = GetSightPointCache(sight_check.destination.X, sight_check.destination.Y);
+}
+
 // intercepts found during first pass
 
 struct WallIntercept
@@ -175,8 +300,8 @@ static bool CrossSubsector(Subsector *sub)
         divl.delta_x = ld->delta_x;
         divl.delta_y = ld->delta_y;
 
-        s1 = PointOnDividingLineSide(sight_check.source.x, sight_check.source.y, &divl);
-        s2 = PointOnDividingLineSide(sight_check.destination.X, sight_check.destination.Y, &divl);
+        s1 = SightLineSide(sight_check.source_cache, ld, &divl);
+        s2 = SightLineSide(sight_check.destination_cache, ld, &divl);
 
         if (s1 == s2)
             continue;
@@ -270,8 +395,8 @@ static bool CheckSightBSP(unsigned int bspnum)
 #endif
 
         // decide which side the src and dest points are on
-        s1 = PointOnDividingLineSide(sight_check.source.x, sight_check.source.y, &node->divider);
-        s2 = PointOnDividingLineSide(sight_check.destination.X, sight_check.destination.Y, &node->divider);
+        s1 = SightNodeSide(sight_check.source_cache, bspnum);
+        s2 = SightNodeSide(sight_check.destination_cache, bspnum);
 
 #if (EDGE_DEBUG_SIGHT >= 2)
         LogDebug("  Sides: %d %d\n", s1, s2);
@@ -420,6 +545,8 @@ static bool CheckSightSameSubsector(MapObject *src, MapObject *dest)
 
 bool CheckSight(MapObject *src, MapObject *dest)
 {
+    EDGE_ProfileScope(kProfileTimerSight);
+
     // -ACB- 1998/07/20 t2 is Invisible, t1 cannot possibly see it.
     if (AlmostEquals(dest->visibility_, 0.0f))
         return false;
@@ -502,6 +629,8 @@ bool CheckSight(MapObject *src, MapObject *dest)
     sight_check.saw_extrafloors   = false;
     sight_check.saw_vertex_slopes = false;
 
+    SightUseCaches();
+
     // initial pass -- check for basic blockage & create intercepts
     if (!CheckSightBSP(root_node))
         return false;
@@ -575,6 +704,8 @@ bool CheckSight(MapObject *src, MapObject *dest)
 
 bool CheckSightToPoint(MapObject *src, float x, float y, float z)
 {
+    EDGE_ProfileScope(kProfileTimerSight);
+
     Subsector *dest_sub = PointInSubsector(x, y);
 
     if (dest_sub == src->subsector_)
@@ -609,6 +740,8 @@ bool CheckSightToPoint(MapObject *src, float x, float y, float z)
 
     sight_check.saw_extrafloors = false;
 
+    SightUseCaches();
+
     if (!CheckSightBSP(root_node))
         return false;
 
@@ -32,6 +32,7 @@
 #include <limits.h>
 
 #include "AlmostEquals.h"
+#include "am_map.h"
 #include "con_main.h"
 #include "dm_defs.h"
 #include "dm_state.h"
@@ -972,6 +973,8 @@ static void SectorEffect(Sector *target, Line *source, const LineType *special)
         {
             target->ceiling_height = source->front_sector->ceiling_height;
             target->floor_height   = source->front_sector->floor_height;
+
+            automap_changes++;
             for (int i = 0; i < target->line_count; i++)
             {
                 if (target->lines[i]->side[1])
@@ -1277,7 +1280,10 @@ static bool P_ActivateSpecialLine(Line *line, const LineType *special, int tag,
     if (!CheckWhenAppear(special->appear_))
     {
         if (line)
+        {
             line->special = nullptr;
+            automap_changes++;
+        }
 
         return true;
     }
@@ -1696,6 +1702,8 @@ static bool P_ActivateSpecialLine(Line *line, const LineType *special, int tag,
             line->special = (special->newtrignum_ <= 0) ? nullptr : LookupLineType(special->newtrignum_);
         }
 
+        automap_changes++;
+
         ChangeSwitchTexture(line, line->special && (special->newtrignum_ == 0), special->special_flags_, playedSound);
     }
     return true;
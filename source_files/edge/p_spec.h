@@ -53,6 +53,10 @@ struct LightSpecial
 
     // countdown value for FADE type
     int fade_count;
+
+    // light clock tic of the next change, 0 when not scheduled.
+    // While scheduled, count is only brought up to date for saving.
+    int wake_tic = 0;
 };
 
 enum ButtonPosition
@@ -109,6 +113,10 @@ struct PlaneMover
     const Image *new_image;
 
     bool nuke_me = false; // for changers already at their dest height
+
+    // plane clock tic at which a waiting (or in stasis) mover is next
+    // run, 0 when awake.  While asleep, waited is left stale.
+    int wake_tic = 0;
 };
 
 struct SlidingDoorMover
@@ -134,6 +142,9 @@ struct SlidingDoorMover
 
     bool sound_effect_started;
     bool final_open;
+
+    // slider clock tic at which a waiting door is next run, 0 when awake
+    int wake_tic = 0;
 };
 
 struct Force
@@ -194,6 +205,13 @@ void AddActiveSlider(SlidingDoorMover *smov);
 void DestroyAllPlanes(void);
 void DestroyAllSliders(void);
 
+// sleeping movers and lights keep stale counters, these bring them up
+// to date (before saving) and rebuild the schedule (after loading).
+void WakeAllPlanes(void);
+void WakeAllSliders(void);
+void UpdateLightCounts(void);
+void ScheduleAllLights(void);
+
 void AddSpecialLine(Line *ld);
 void AddSpecialSector(Sector *sec);
 void SectorChangeSpecial(Sector *sec, int new_type);
@@ -34,6 +34,7 @@
 #include "AlmostEquals.h"
 #include "dm_state.h"
 #include "g_game.h"
+#include "i_system.h"
 #include "n_network.h"
 #include "p_local.h"
 #include "p_spec.h"
@@ -47,6 +48,10 @@ bool erraticism_active = false;
 
 extern ConsoleVariable erraticism;
 
+// system time (microseconds) and level time when the last tic ended
+static uint32_t tic_finished_at   = 0;
+static int      tic_finished_time = -1;
+
 //
 // MapObjectTicker
 //
@@ -106,12 +111,32 @@ void MapObjectTicker()
     // for par times
     level_time_elapsed++;
 
+    if (!fast_forward_active)
+    {
+        tic_finished_at   = GetMicroseconds();
+        tic_finished_time = level_time_elapsed;
+    }
+
     if (level_time_elapsed >= exit_time && game_action == kGameActionNothing)
     {
         game_action = kGameActionIntermission;
     }
 }
 
+float MapObjectTicFraction(void)
+{
+    // a level change or savegame load leaves nothing to measure from
+    // until the next tic.
+    if (game_state != kGameStateLevel || tic_finished_time != level_time_elapsed)
+        return -1;
+
+    uint32_t elapsed = GetMicroseconds() - tic_finished_at;
+
+    float along = (float)elapsed * kTicRate / 1000000.0f;
+
+    return HMM_Clamp(0.0f, along, 1.0f);
+}
+
 void HubFastForward(void)
 {
     fast_forward_active = true;
@@ -30,6 +30,12 @@
 // Carries out all thinking of monsters and players.
 void MapObjectTicker(void);
 
+// How far [0, 1] the frame being drawn is past the last tic, measured
+// from when that tic finished, or -1 when no tic of the current level
+// has run yet.  Rendering stays on the main thread, reading the live
+// level, so this is the only thing the frame needs from the tic.
+float MapObjectTicFraction(void);
+
 void HubFastForward(void);
 
 // Needed to pause flat anims, etc when not moving or firing in Erraticism
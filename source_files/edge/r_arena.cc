@@ -0,0 +1,116 @@
+//----------------------------------------------------------------------------
+//  EDGE Per-Frame Render Arena
+//----------------------------------------------------------------------------
+//
+//  Copyright (c) 2024 The EDGE Team.
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation; either version 3
+//  of the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//----------------------------------------------------------------------------
+
+#include "r_arena.h"
+
+#include <stdlib.h>
+
+#include "HandmadeMath.h"
+#include "epi.h"
+
+// enough for the draw structures of a typical map
+FrameArena render_frame_arena(1 << 20);
+
+FrameArena::FrameArena(size_t block_size)
+    : first_(nullptr), current_(nullptr), pos_(nullptr), end_(nullptr), block_size_(block_size)
+{
+}
+
+FrameArena::~FrameArena()
+{
+    Free();
+}
+
+void FrameArena::Reset()
+{
+    // when the last frame needed several blocks, replace them with a
+    // single one of the same total size, keeping the memory contiguous.
+    if (first_ != nullptr && first_->next_ != nullptr)
+    {
+        block_size_ = HMM_MAX(block_size_, Capacity());
+        Free();
+    }
+
+    current_ = first_;
+
+    if (current_ != nullptr)
+    {
+        pos_ = current_->data_;
+        end_ = current_->data_ + current_->size_;
+    }
+}
+
+void FrameArena::Free()
+{
+    while (first_ != nullptr)
+    {
+        Block *next = first_->next_;
+        free(first_);
+        first_ = next;
+    }
+
+    current_ = nullptr;
+    pos_     = nullptr;
+    end_     = nullptr;
+}
+
+size_t FrameArena::Capacity() const
+{
+    size_t total = 0;
+
+    for (Block *b = first_; b != nullptr; b = b->next_)
+        total += b->size_;
+
+    return total;
+}
+
+void *FrameArena::AllocateSlow(size_t size, size_t align)
+{
+    // use the next block of the chain if it is big enough, otherwise
+    // put a new one after the current block.
+    Block *next = (current_ != nullptr) ? current_->next_ : first_;
+
+    if (next == nullptr || next->size_ < size + align)
+    {
+        size_t block_size = HMM_MAX(block_size_, size + align);
+
+        Block *block = (Block *)malloc(sizeof(Block) + block_size);
+        if (block == nullptr)
+            FatalError("FrameArena: out of memory (%d bytes)\n", (int)block_size);
+
+        block->size_ = block_size;
+        block->data_ = (uint8_t *)(block + 1);
+        block->next_ = next;
+
+        if (current_ != nullptr)
+            current_->next_ = block;
+        else
+            first_ = block;
+
+        next = block;
+    }
+
+    current_ = next;
+    pos_     = current_->data_;
+    end_     = current_->data_ + current_->size_;
+
+    return Allocate(size, align);
+}
+
+//--- editor settings ---
+// vi:ts=4:sw=4:noexpandtab
@@ -0,0 +1,224 @@
+//----------------------------------------------------------------------------
+//  EDGE Per-Frame Render Arena
+//----------------------------------------------------------------------------
+//
+//  Copyright (c) 2024 The EDGE Team.
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation; either version 3
+//  of the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//----------------------------------------------------------------------------
+//
+//  A linear allocator for the structures built while walking the BSP.
+//  Memory comes from a chain of blocks which is only ever added to,
+//  so pointers stay valid until Reset(), which rewinds everything at
+//  once (it is called from ClearBSP, once per rendered view).  After
+//  the first few frames no heap allocation happens at all.
+//
+//  Nothing allocated here is ever destroyed, hence only trivially
+//  destructible types are allowed.
+//
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <new>
+#include <type_traits>
+
+class FrameArena
+{
+  private:
+    class Block
+    {
+      public:
+        Block   *next_;
+        size_t   size_;
+        uint8_t *data_;
+    };
+
+    Block *first_;
+    Block *current_;
+
+    uint8_t *pos_;
+    uint8_t *end_;
+
+    size_t block_size_;
+
+  public:
+    FrameArena(size_t block_size);
+    ~FrameArena();
+
+    void *Allocate(size_t size, size_t align)
+    {
+        uintptr_t p = ((uintptr_t)pos_ + (align - 1)) & ~(uintptr_t)(align - 1);
+
+        if (pos_ != nullptr && p + size <= (uintptr_t)end_)
+        {
+            pos_ = (uint8_t *)(p + size);
+            return (void *)p;
+        }
+
+        return AllocateSlow(size, align);
+    }
+
+    // value-initialised, like a newly resized vector element
+    template <typename T> T *New()
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "FrameArena cannot destroy objects");
+
+        return new (Allocate(sizeof(T), alignof(T))) T();
+    }
+
+    // uninitialised
+    template <typename T> T *NewArray(size_t count)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "FrameArena cannot destroy objects");
+
+        return (T *)Allocate(sizeof(T) * count, alignof(T));
+    }
+
+    // forget everything allocated, keeping the blocks for reuse
+    void Reset();
+
+    // give all the blocks back
+    void Free();
+
+    // total bytes held in blocks
+    size_t Capacity() const;
+
+  private:
+    void *AllocateSlow(size_t size, size_t align);
+};
+
+//
+// A doubly linked list whose nodes live in a FrameArena.  Like the
+// arena it never frees anything, Clear() merely forgets the nodes.
+//
+template <typename T> class FrameList
+{
+  private:
+    class Node
+    {
+      public:
+        T     value_;
+        Node *next_;
+        Node *previous_;
+    };
+
+    Node *head_;
+    Node *tail_;
+    int   size_;
+
+  public:
+    class Iterator
+    {
+      private:
+        Node *node_;
+        bool  reverse_;
+
+      public:
+        Iterator(Node *node, bool reverse) : node_(node), reverse_(reverse)
+        {
+        }
+
+        T &operator*() const
+        {
+            return node_->value_;
+        }
+
+        Iterator &operator++()
+        {
+            node_ = reverse_ ? node_->previous_ : node_->next_;
+            return *this;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return node_ != other.node_;
+        }
+    };
+
+  public:
+    // no destructor, so that structures holding a list can themselves
+    // live in the arena
+    FrameList() : head_(nullptr), tail_(nullptr), size_(0)
+    {
+    }
+
+    void Clear()
+    {
+        head_ = tail_ = nullptr;
+        size_         = 0;
+    }
+
+    void PushBack(FrameArena &arena, const T &value)
+    {
+        Node *node      = arena.New<Node>();
+        node->value_    = value;
+        node->previous_ = tail_;
+
+        if (tail_ != nullptr)
+            tail_->next_ = node;
+        else
+            head_ = node;
+
+        tail_ = node;
+        size_++;
+    }
+
+    bool Empty() const
+    {
+        return size_ == 0;
+    }
+
+    int Size() const
+    {
+        return size_;
+    }
+
+    T &First() const
+    {
+        return head_->value_;
+    }
+
+    T &Last() const
+    {
+        return tail_->value_;
+    }
+
+    Iterator begin() const
+    {
+        return Iterator(head_, false);
+    }
+
+    Iterator end() const
+    {
+        return Iterator(nullptr, false);
+    }
+
+    // last to first
+    Iterator rbegin() const
+    {
+        return Iterator(tail_, true);
+    }
+
+    Iterator rend() const
+    {
+        return Iterator(nullptr, true);
+    }
+};
+
+// the arena used by the BSP walk, reset by ClearBSP()
+extern FrameArena render_frame_arena;
+
+//--- editor settings ---
+// vi:ts=4:sw=4:noexpandtab
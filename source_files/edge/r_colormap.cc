@@ -754,10 +754,15 @@ class ColormapShader : public AbstractShader
     }
 
   public:
+    bool NeedsUpdate() const
+    {
+        return (fade_texture_ == 0 || (force_flat_lighting.d_ && lighting_model_ != kLightingModelFlat) ||
+                (!force_flat_lighting.d_ && lighting_model_ != current_map->episode_->lighting_));
+    }
+
     void Update()
     {
-        if (fade_texture_ == 0 || (force_flat_lighting.d_ && lighting_model_ != kLightingModelFlat) ||
-            (!force_flat_lighting.d_ && lighting_model_ != current_map->episode_->lighting_))
+        if (NeedsUpdate())
         {
             if (fade_texture_ != 0)
             {
@@ -773,6 +778,17 @@ class ColormapShader : public AbstractShader
         }
     }
 
+    // copies the colormap tables (and borrows the fade texture) of
+    // another shader.  Used for the private copies of worker threads.
+    void CopyTables(const ColormapShader *other)
+    {
+        colormap_       = other->colormap_;
+        fade_texture_   = other->fade_texture_;
+        lighting_model_ = other->lighting_model_;
+
+        memcpy(whites_, other->whites_, sizeof(whites_));
+    }
+
     void DeleteTex()
     {
         if (fade_texture_ != 0)
@@ -801,7 +817,30 @@ class ColormapShader : public AbstractShader
 
 static ColormapShader *standard_colormap_shader;
 
-AbstractShader *GetColormapShader(const struct RegionProperties *props, int light_add, Sector *sec)
+// private shaders for threads which are recording units (see r_units),
+// since the shared ones get a new light level on every call.  Never
+// freed, as they do not own their fade texture.
+static constexpr uint8_t kRecordingShaderCount = 4;
+
+static thread_local ColormapShader *recording_shaders[kRecordingShaderCount];
+static thread_local int             recording_shader_index;
+
+static ColormapShader *RecordingColormapShader(const ColormapShader *master)
+{
+    recording_shader_index = (recording_shader_index + 1) % kRecordingShaderCount;
+
+    ColormapShader *&shader = recording_shaders[recording_shader_index];
+
+    if (!shader)
+        shader = new ColormapShader(nullptr);
+
+    if (master)
+        shader->CopyTables(master);
+
+    return shader;
+}
+
+static ColormapShader *GetSharedColormapShader(const struct RegionProperties *props)
 {
     if (!standard_colormap_shader)
         standard_colormap_shader = new ColormapShader(nullptr);
@@ -826,6 +865,26 @@ AbstractShader *GetColormapShader(const struct RegionProperties *props, int ligh
 
     shader->Update();
 
+    return shader;
+}
+
+AbstractShader *GetColormapShader(const struct RegionProperties *props, int light_add, Sector *sec)
+{
+    ColormapShader *shader;
+
+    if (UnitRecordingActive())
+    {
+        shader = props->colourmap ? (ColormapShader *)props->colourmap->analysis_ : standard_colormap_shader;
+
+        // creating or updating a shader needs the GL
+        if (!shader || shader->NeedsUpdate())
+            UnitRecordingHazard();
+
+        shader = RecordingColormapShader(shader);
+    }
+    else
+        shader = GetSharedColormapShader(props);
+
     int lit_Nom = props->light_level + light_add + ((sector_brightness_correction.d_ - 5) * 10);
 
     if (!(props->colourmap && (props->colourmap->special_ & kColorSpecialNoFlash)) || render_view_extra_light > 250)
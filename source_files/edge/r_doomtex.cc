@@ -33,6 +33,8 @@
 
 #include <limits.h>
 
+#include <optional>
+
 #include "dm_state.h"
 #include "e_main.h"
 #include "e_search.h"
@@ -161,17 +163,23 @@ static ImageData *ReadFlatAsEpiBlock(Image *rim)
     // clear initial image to black
     img->Clear(playpal_black);
 
-    const uint8_t *src = nullptr;
+    const uint8_t *src      = nullptr;
+    uint8_t       *pack_src = nullptr;
+
+    std::optional<LumpView> view;
 
     if (rim->source_.graphic.packfile_name)
     {
         epi::File *f = OpenFileFromPack(rim->source_.graphic.packfile_name);
         if (f)
-            src = (const uint8_t *)f->LoadIntoMemory();
+            src = pack_src = f->LoadIntoMemory();
         delete f;
     }
     else
-        src = (const uint8_t *)LoadLumpIntoMemory(rim->source_.flat.lump);
+    {
+        view.emplace(rim->source_.flat.lump);
+        src = view->GetData();
+    }
 
     if (!src)
         FatalError("ReadFlatAsEpiBlock: Failed to load %s!\n", rim->name_.c_str());
@@ -191,7 +199,7 @@ static ImageData *ReadFlatAsEpiBlock(Image *rim)
                 dest_pix[0] = src_pix;
         }
 
-    delete[] src;
+    delete[] pack_src;
 
     // CW: Textures MUST tile! If actual size not total size, manually tile
     // [ AJA: this does not make them tile, just fills in the black gaps ]
@@ -240,9 +248,11 @@ static ImageData *ReadTextureAsEpiBlock(Image *rim)
     // Composite the columns into the block.
     for (i = 0, patch = tdef->patches; i < tdef->patch_count; i++, patch++)
     {
-        const Patch *realpatch = (const Patch *)LoadLumpIntoMemory(patch->patch);
+        LumpView patch_data(patch->patch);
 
-        int realsize = GetLumpLength(patch->patch);
+        const Patch *realpatch = (const Patch *)patch_data.GetData();
+
+        int realsize = patch_data.GetSize();
 
         int x1 = patch->origin_x;
         int y1 = patch->origin_y;
@@ -266,8 +276,6 @@ static ImageData *ReadTextureAsEpiBlock(Image *rim)
 
             DrawColumnIntoEpiBlock(rim, img, patchcol, x, y1);
         }
-
-        delete[] realpatch;
     }
 
     // CW: Textures MUST tile! If actual size not total size, manually tile
@@ -335,16 +343,20 @@ static ImageData *ReadPatchAsEpiBlock(Image *rim)
         img->Clear(kTransparentPixelIndex);
 
     // Composite the columns into the block.
-    const Patch *realpatch = nullptr;
-    int          realsize  = 0;
+    const Patch *realpatch  = nullptr;
+    uint8_t     *pack_patch = nullptr;
+    int          realsize   = 0;
+
+    std::optional<LumpView> view;
 
     if (packfile_name)
     {
         epi::File *f = OpenFileFromPack(packfile_name);
         if (f)
         {
-            realpatch = (const Patch *)f->LoadIntoMemory();
-            realsize  = f->GetLength();
+            pack_patch = f->LoadIntoMemory();
+            realpatch  = (const Patch *)pack_patch;
+            realsize   = f->GetLength();
         }
         else
             FatalError("ReadPatchAsEpiBlock: Failed to load %s!\n", packfile_name);
@@ -352,8 +364,9 @@ static ImageData *ReadPatchAsEpiBlock(Image *rim)
     }
     else
     {
-        realpatch = (const Patch *)LoadLumpIntoMemory(lump);
-        realsize  = GetLumpLength(lump);
+        view.emplace(lump);
+        realpatch = (const Patch *)view->GetData();
+        realsize  = view->GetSize();
     }
 
     EPI_ASSERT(realpatch);
@@ -378,7 +391,7 @@ static ImageData *ReadPatchAsEpiBlock(Image *rim)
         DrawColumnIntoEpiBlock(rim, img, patchcol, x, 0);
     }
 
-    delete[] realpatch;
+    delete[] pack_patch;
 
     return img;
 }
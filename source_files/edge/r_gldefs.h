@@ -25,12 +25,12 @@
 
 #pragma once
 
-#include <list>
 #include <vector>
 
 #include "con_var.h"
 #include "ddf_image.h"
 #include "ddf_main.h"
+#include "r_arena.h"
 #include "r_defs.h"
 
 extern ConsoleVariable renderer_dumb_sky;
@@ -161,7 +161,7 @@ struct DrawMirror
 
     bool is_portal = false;
 
-    std::list<DrawSubsector *> draw_subsectors;
+    FrameList<DrawSubsector *> draw_subsectors;
 };
 
 struct DrawSeg // HOPEFULLY this can go away
@@ -174,14 +174,14 @@ struct DrawSubsector
     Subsector *subsector = nullptr;
 
     // floors, sorted in height order (lowest to highest).
-    std::vector<DrawFloor *> floors;
+    FrameList<DrawFloor *> floors;
 
     // link list of floors, render order (furthest to closest)
     DrawFloor *render_floors;
 
-    std::list<DrawSeg *> segs;
+    FrameList<DrawSeg *> segs;
 
-    std::list<DrawMirror *> mirrors;
+    FrameList<DrawMirror *> mirrors;
 
     bool visible;
     bool sorted;
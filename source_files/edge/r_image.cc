@@ -1832,6 +1832,39 @@ void ImagePrecache(const Image *image)
     }
 }
 
+void ImagePreinflate(const Image **images, int count)
+{
+    std::vector<std::string> names;
+
+    for (int i = 0; i < count; i++)
+    {
+        const Image *rim = images[i];
+
+        if (rim == nullptr || !rim->cache_.empty())
+            continue;
+
+        switch (rim->source_type_)
+        {
+        case kImageSourceGraphic:
+        case kImageSourceSprite:
+        case kImageSourceTXHI:
+            if (rim->source_.graphic.packfile_name)
+                names.push_back(rim->source_.graphic.packfile_name);
+            break;
+
+        case kImageSourceUser:
+            if (rim->source_.user.def->type_ == kImageDataPackage)
+                names.push_back(rim->source_.user.def->info_);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    PreinflatePackFiles(names);
+}
+
 //----------------------------------------------------------------------------
 
 static void W_CreateDummyImages(void)
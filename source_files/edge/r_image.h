@@ -280,6 +280,10 @@ void CreateFallbackTexture(void);
 GLuint ImageCache(const Image *image, bool anim = true, const Colormap *trans = nullptr, bool do_whiten = false);
 void   ImagePrecache(const Image *image);
 
+// inflate the EPK entries of all (not yet cached) images in one go,
+// before they get precached one by one.
+void ImagePreinflate(const Image **images, int count);
+
 // this only needed during initialisation -- r_things.cpp
 const Image **GetUserSprites(int *count);
 
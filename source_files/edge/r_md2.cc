@@ -217,6 +217,9 @@ struct MD2Frame
 
     // list of normals which are used.  Terminated by -1.
     short *used_normals_;
+
+    // copy of the vertex positions, laid out for blending
+    ModelPose pose_;
 };
 
 struct MD2Point
@@ -318,6 +321,19 @@ static short *CreateNormalList(uint8_t *which_normals)
     return n_list;
 }
 
+static void CreateFramePoses(MD2Model *md)
+{
+    for (int i = 0; i < md->total_frames_; i++)
+    {
+        MD2Frame *frame = &md->frames_[i];
+
+        frame->pose_.Resize(md->vertices_per_frame_);
+
+        for (int v = 0; v < md->vertices_per_frame_; v++)
+            frame->pose_.Set(v, frame->vertices[v].x, frame->vertices[v].y, frame->vertices[v].z);
+    }
+}
+
 MD2Model *MD2Load(epi::File *f)
 {
     int i;
@@ -499,6 +515,8 @@ MD2Model *MD2Load(epi::File *f)
 
     delete[] raw_verts;
 
+    CreateFramePoses(md);
+
     glGenBuffers(1, &md->vertex_buffer_object_);
     if (md->vertex_buffer_object_ == 0)
         FatalError("MD2LoadModel: Failed to bind VBO!\n");
@@ -758,6 +776,9 @@ MD2Model *MD3Load(epi::File *f)
 
         // TODO: load in bbox (for visibility checking)
     }
+
+    CreateFramePoses(md);
+
     glGenBuffers(1, &md->vertex_buffer_object_);
     if (md->vertex_buffer_object_ == 0)
         FatalError("MD3LoadModel: Failed to create VBO!\n");
@@ -775,9 +796,8 @@ class MD2CoordinateData
 
     MD2Model *model_;
 
-    const MD2Frame    *frame1_;
-    const MD2Frame    *frame2_;
-    const MD2Triangle *triangles_;
+    const MD2Frame *frame1_;
+    const MD2Frame *frame2_;
 
     float lerp_;
     float x_, y_, z_;
@@ -808,30 +828,16 @@ class MD2CoordinateData
 
     ColorMixer normal_colors_[kTotalMDFormatNormals];
 
+    // world space normals, only valid for the used ones
+    HMM_Vec3 normals_[kTotalMDFormatNormals];
+
     short *used_normals_;
 
     bool is_additive_;
 
   public:
-    void CalcPos(HMM_Vec3 *pos, float x1, float y1, float z1) const
+    void CalcNormal(HMM_Vec3 *normal, short n) const
     {
-        x1 *= xy_scale_;
-        y1 *= xy_scale_;
-        z1 *= z_scale_;
-
-        float x2 = x1 * mouselook_x_matrix_.X + z1 * mouselook_x_matrix_.Y;
-        float z2 = x1 * mouselook_z_matrix_.X + z1 * mouselook_z_matrix_.Y;
-        float y2 = y1;
-
-        pos->X = x_ + x2 * rotation_x_matrix_.X + y2 * rotation_x_matrix_.Y;
-        pos->Y = y_ + x2 * rotation_y_matrix_.X + y2 * rotation_y_matrix_.Y;
-        pos->Z = z_ + z2;
-    }
-
-    void CalcNormal(HMM_Vec3 *normal, const MD2Vertex *vert) const
-    {
-        short n = vert->normal_idx;
-
         float nx1 = md_normals[n].X;
         float ny1 = md_normals[n].Y;
         float nz1 = md_normals[n].Z;
@@ -846,6 +852,9 @@ class MD2CoordinateData
     }
 };
 
+// world space vertex positions of the model being drawn
+static ModelPose md2_world_pose;
+
 static void InitNormalColors(MD2CoordinateData *data)
 {
     short *n_list = data->used_normals_;
@@ -931,70 +940,93 @@ static void UpdateMulticols(MD2CoordinateData *data)
     }
 }
 
-static inline float LerpIt(float v1, float v2, float lerp)
+static void CalcNormals(MD2CoordinateData *data)
 {
-    return v1 * (1.0f - lerp) + v2 * lerp;
+    short *n_list = data->used_normals_;
+
+    for (; *n_list >= 0; n_list++)
+        data->CalcNormal(&data->normals_[*n_list], *n_list);
 }
 
-static inline void ModelCoordFunc(MD2CoordinateData *data, int v_idx, HMM_Vec3 *pos, float *rgb, HMM_Vec2 *texc,
-                                  HMM_Vec3 *normal)
+// positions, normals and texture coords are the same for every pass
+static void ModelGeometryFunc(MD2CoordinateData *data, const ModelPose *pose)
 {
     const MD2Model *md = data->model_;
 
-    const MD2Frame    *frame1 = data->frame1_;
-    const MD2Frame    *frame2 = data->frame2_;
-    const MD2Triangle *tri    = data->triangles_;
+    const MD2Frame *n_frame = (data->lerp_ < 0.5) ? data->frame1_ : data->frame2_;
 
-    EPI_ASSERT(tri->first + v_idx >= 0);
-    EPI_ASSERT(tri->first + v_idx < md->total_points_);
+    RendererVertex *dest = md->gl_vertices_;
 
-    const MD2Point *point = &md->points_[tri->first + v_idx];
+    for (int i = 0; i < md->total_triangles_; i++)
+    {
+        const MD2Triangle *tri = &md->triangles_[i];
 
-    const MD2Vertex *vert1 = &frame1->vertices[point->vert_idx];
-    const MD2Vertex *vert2 = &frame2->vertices[point->vert_idx];
+        for (int v_idx = 0; v_idx < 3; v_idx++, dest++)
+        {
+            EPI_ASSERT(tri->first + v_idx >= 0);
+            EPI_ASSERT(tri->first + v_idx < md->total_points_);
 
-    float x1 = LerpIt(vert1->x, vert2->x, data->lerp_);
-    float y1 = LerpIt(vert1->y, vert2->y, data->lerp_);
-    float z1 = LerpIt(vert1->z, vert2->z, data->lerp_) + data->bias_;
+            const MD2Point *point = &md->points_[tri->first + v_idx];
 
-    if (MirrorReflective())
-        y1 = -y1;
+            int v = point->vert_idx;
 
-    data->CalcPos(pos, x1, y1, z1);
+            dest->position = {{pose->X(v), pose->Y(v), pose->Z(v)}};
+            dest->normal   = data->normals_[n_frame->vertices[v].normal_idx];
 
-    const MD2Vertex *n_vert = (data->lerp_ < 0.5) ? vert1 : vert2;
+            if (data->is_fuzzy_)
+            {
+                dest->texture_coordinates[0].X = point->skin_s * data->fuzz_multiplier_ + data->fuzz_add_.X;
+                dest->texture_coordinates[0].Y = point->skin_t * data->fuzz_multiplier_ + data->fuzz_add_.Y;
+            }
+            else
+            {
+                dest->texture_coordinates[0] = {{point->skin_s * data->image_right_, point->skin_t * data->image_top_}};
+            }
+        }
+    }
+}
+
+static void ModelColorFunc(MD2CoordinateData *data, float trans)
+{
+    const MD2Model *md = data->model_;
+
+    const MD2Frame *n_frame = (data->lerp_ < 0.5) ? data->frame1_ : data->frame2_;
 
-    data->CalcNormal(normal, n_vert);
+    RendererVertex *dest = md->gl_vertices_;
 
-    if (data->is_fuzzy_)
+    for (int i = 0; i < md->total_points_; i++, dest++)
     {
-        texc->X = point->skin_s * data->fuzz_multiplier_ + data->fuzz_add_.X;
-        texc->Y = point->skin_t * data->fuzz_multiplier_ + data->fuzz_add_.Y;
+        float *rgb = dest->rgba_color;
 
-        rgb[0] = rgb[1] = rgb[2] = 0;
-        return;
-    }
+        rgb[3] = trans;
+
+        if (data->is_fuzzy_)
+        {
+            rgb[0] = rgb[1] = rgb[2] = 0;
+            continue;
+        }
 
-    *texc = {{point->skin_s * data->image_right_, point->skin_t * data->image_top_}};
+        const MD2Point *point = &md->points_[md->triangles_[i / 3].first + (i % 3)];
 
-    ColorMixer *col = &data->normal_colors_[n_vert->normal_idx];
+        ColorMixer *col = &data->normal_colors_[n_frame->vertices[point->vert_idx].normal_idx];
 
-    if (!data->is_additive_)
-    {
-        rgb[0] = col->modulate_red_ / 255.0;
-        rgb[1] = col->modulate_green_ / 255.0;
-        rgb[2] = col->modulate_blue_ / 255.0;
-    }
-    else
-    {
-        rgb[0] = col->add_red_ / 255.0;
-        rgb[1] = col->add_green_ / 255.0;
-        rgb[2] = col->add_blue_ / 255.0;
-    }
+        if (!data->is_additive_)
+        {
+            rgb[0] = col->modulate_red_ / 255.0;
+            rgb[1] = col->modulate_green_ / 255.0;
+            rgb[2] = col->modulate_blue_ / 255.0;
+        }
+        else
+        {
+            rgb[0] = col->add_red_ / 255.0;
+            rgb[1] = col->add_green_ / 255.0;
+            rgb[2] = col->add_blue_ / 255.0;
+        }
 
-    rgb[0] *= render_view_red_multiplier;
-    rgb[1] *= render_view_green_multiplier;
-    rgb[2] *= render_view_blue_multiplier;
+        rgb[0] *= render_view_red_multiplier;
+        rgb[1] *= render_view_green_multiplier;
+        rgb[2] *= render_view_blue_multiplier;
+    }
 }
 
 void MD2RenderModel(MD2Model *md, const Image *skin_img, bool is_weapon, int frame1, int frame2, float lerp, float x,
@@ -1151,6 +1183,31 @@ void MD2RenderModel(MD2Model *md, const Image *skin_img, bool is_weapon, int fra
         }
     }
 
+    /* compute the geometry */
+
+    ModelTransform transform;
+
+    transform.x_                  = x;
+    transform.y_                  = y;
+    transform.z_                  = z;
+    transform.xy_scale_           = data.xy_scale_;
+    transform.y_scale_            = MirrorReflective() ? -data.xy_scale_ : data.xy_scale_;
+    transform.z_scale_            = data.z_scale_;
+    transform.bias_               = data.bias_;
+    transform.mouselook_x_matrix_ = data.mouselook_x_matrix_;
+    transform.mouselook_z_matrix_ = data.mouselook_z_matrix_;
+    transform.rotation_x_matrix_  = data.rotation_x_matrix_;
+    transform.rotation_y_matrix_  = data.rotation_y_matrix_;
+
+    const ModelPose *pose =
+        InterpolateModelPose(md, frame1, frame2, &data.frame1_->pose_, &data.frame2_->pose_, data.lerp_);
+
+    TransformModelPose(pose, &transform, &md2_world_pose);
+
+    CalcNormals(&data);
+
+    ModelGeometryFunc(&data, &md2_world_pose);
+
     /* draw the model */
 
     int num_pass = data.is_fuzzy_ ? 1 : (detail_level > 0 ? 4 : 3);
@@ -1330,22 +1387,7 @@ void MD2RenderModel(MD2Model *md, const Image *skin_img, bool is_weapon, int fra
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, renderer_dumb_clamp.d_ ? GL_CLAMP : GL_CLAMP_TO_EDGE);
         }
 
-        RendererVertex *start = md->gl_vertices_;
-
-        for (int i = 0; i < md->total_triangles_; i++)
-        {
-            data.triangles_ = &md->triangles_[i];
-
-            for (int v_idx = 0; v_idx < 3; v_idx++)
-            {
-                RendererVertex *dest = start + (i * 3) + v_idx;
-
-                ModelCoordFunc(&data, v_idx, &dest->position, dest->rgba_color, &dest->texture_coordinates[0],
-                               &dest->normal);
-
-                dest->rgba_color[3] = trans;
-            }
-        }
+        ModelColorFunc(&data, trans);
 
         // setup client state
         glBindBuffer(GL_ARRAY_BUFFER, md->vertex_buffer_object_);
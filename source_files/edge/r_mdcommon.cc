@@ -0,0 +1,194 @@
+//----------------------------------------------------------------------------
+//  MDL/2/3 Model Format Common Code
+//----------------------------------------------------------------------------
+//
+//  Copyright (c) 2024 The EDGE Team.
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation; either version 3
+//  of the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//----------------------------------------------------------------------------
+
+#include "r_mdcommon.h"
+
+#include <stdint.h>
+
+#include <unordered_map>
+#include <vector>
+
+#include "epi.h"
+#include "r_misc.h"
+
+// number of distinct poses between two frames.  Quantising the lerp
+// is what lets instances share a pose; at this resolution the error
+// is well below a pixel.
+static constexpr int kModelPoseLerpSteps = 256;
+
+class CachedModelPose
+{
+  public:
+    const void *model_;
+
+    int frame1_;
+    int frame2_;
+    int step_;
+
+    ModelPose pose_;
+
+  public:
+    CachedModelPose() : model_(nullptr), frame1_(-1), frame2_(-1), step_(-1), pose_()
+    {
+    }
+
+    ~CachedModelPose()
+    {
+    }
+};
+
+// poses live until the next render frame, their storage is reused
+static std::vector<CachedModelPose *> pose_pool;
+static int                            pose_pool_used = 0;
+
+static std::unordered_map<uint64_t, CachedModelPose *> pose_cache;
+static int                                             pose_cache_frame = -1;
+
+void ModelPose::Resize(int total_vertices)
+{
+    if (total_vertices == total_vertices_)
+        return;
+
+    delete[] lanes_;
+
+    total_vertices_ = total_vertices;
+    total_blocks_   = (total_vertices + 3) / 4;
+
+    lanes_ = new HMM_Vec4[total_blocks_ * 3];
+
+    // keep the padding lanes of the last block finite
+    for (int i = 0; i < total_blocks_ * 3; i++)
+        lanes_[i] = HMM_V4(0, 0, 0, 0);
+}
+
+static void BlendModelPoses(const ModelPose *pose1, const ModelPose *pose2, float lerp, ModelPose *dest)
+{
+    dest->Resize(pose1->total_vertices_);
+
+    int count = pose1->total_blocks_ * 3;
+
+    for (int i = 0; i < count; i++)
+        dest->lanes_[i] = HMM_LerpV4(pose1->lanes_[i], lerp, pose2->lanes_[i]);
+}
+
+static uint64_t ModelPoseKey(const void *model, int frame1, int frame2, int step)
+{
+    uint64_t key = (uint64_t)(uintptr_t)model * UINT64_C(0x9E3779B97F4A7C15);
+
+    key ^= (uint64_t)frame1 << 40;
+    key ^= (uint64_t)frame2 << 16;
+    key ^= (uint64_t)step;
+
+    return key;
+}
+
+const ModelPose *InterpolateModelPose(const void *model, int frame1, int frame2, const ModelPose *pose1,
+                                      const ModelPose *pose2, float lerp)
+{
+    EPI_ASSERT(pose1->total_vertices_ == pose2->total_vertices_);
+
+    int step = (int)(HMM_Clamp(0.0f, lerp, 1.0f) * kModelPoseLerpSteps + 0.5f);
+
+    if (frame1 == frame2 || step == 0)
+        return pose1;
+    if (step == kModelPoseLerpSteps)
+        return pose2;
+
+    if (pose_cache_frame != render_frame_count)
+    {
+        pose_cache.clear();
+        pose_pool_used   = 0;
+        pose_cache_frame = render_frame_count;
+    }
+
+    uint64_t key = ModelPoseKey(model, frame1, frame2, step);
+
+    CachedModelPose *cached = nullptr;
+
+    auto find = pose_cache.find(key);
+
+    if (find != pose_cache.end())
+    {
+        cached = find->second;
+
+        if (cached->model_ == model && cached->frame1_ == frame1 && cached->frame2_ == frame2 && cached->step_ == step)
+            return &cached->pose_;
+
+        // a hash collision: the newcomer takes over the entry
+    }
+    else
+    {
+        if (pose_pool_used == (int)pose_pool.size())
+            pose_pool.push_back(new CachedModelPose());
+
+        cached = pose_pool[pose_pool_used++];
+
+        pose_cache[key] = cached;
+    }
+
+    cached->model_  = model;
+    cached->frame1_ = frame1;
+    cached->frame2_ = frame2;
+    cached->step_   = step;
+
+    BlendModelPoses(pose1, pose2, (float)step / kModelPoseLerpSteps, &cached->pose_);
+
+    return &cached->pose_;
+}
+
+void TransformModelPose(const ModelPose *src, const ModelTransform *transform, ModelPose *dest)
+{
+    dest->Resize(src->total_vertices_);
+
+    int blocks = src->total_blocks_;
+
+    const HMM_Vec4 *src_x = src->lanes_;
+    const HMM_Vec4 *src_y = src_x + blocks;
+    const HMM_Vec4 *src_z = src_y + blocks;
+
+    HMM_Vec4 *dest_x = dest->lanes_;
+    HMM_Vec4 *dest_y = dest_x + blocks;
+    HMM_Vec4 *dest_z = dest_y + blocks;
+
+    const HMM_Vec2 &mlook_x = transform->mouselook_x_matrix_;
+    const HMM_Vec2 &mlook_z = transform->mouselook_z_matrix_;
+    const HMM_Vec2 &rot_x   = transform->rotation_x_matrix_;
+    const HMM_Vec2 &rot_y   = transform->rotation_y_matrix_;
+
+    HMM_Vec4 bias     = HMM_V4(transform->bias_, transform->bias_, transform->bias_, transform->bias_);
+    HMM_Vec4 origin_x = HMM_V4(transform->x_, transform->x_, transform->x_, transform->x_);
+    HMM_Vec4 origin_y = HMM_V4(transform->y_, transform->y_, transform->y_, transform->y_);
+    HMM_Vec4 origin_z = HMM_V4(transform->z_, transform->z_, transform->z_, transform->z_);
+
+    for (int b = 0; b < blocks; b++)
+    {
+        HMM_Vec4 x1 = src_x[b] * transform->xy_scale_;
+        HMM_Vec4 y1 = src_y[b] * transform->y_scale_;
+        HMM_Vec4 z1 = (src_z[b] + bias) * transform->z_scale_;
+
+        HMM_Vec4 x2 = x1 * mlook_x.X + z1 * mlook_x.Y;
+        HMM_Vec4 z2 = x1 * mlook_z.X + z1 * mlook_z.Y;
+
+        dest_x[b] = origin_x + x2 * rot_x.X + y1 * rot_x.Y;
+        dest_y[b] = origin_y + x2 * rot_y.X + y1 * rot_y.Y;
+        dest_z[b] = origin_z + z2;
+    }
+}
+
+//--- editor settings ---
+// vi:ts=4:sw=4:noexpandtab
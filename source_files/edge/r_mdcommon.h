@@ -18,6 +18,85 @@
 
 #pragma once
 
+#include <stdint.h>
+
+#include "HandmadeMath.h"
+
+/* ---- vertex poses ---- */
+
+// Vertex positions of one model frame (or a blend of two frames).
+// Stored as structure-of-arrays in blocks of four vertices, so that
+// blending and transforming handles four vertices per operation.
+class ModelPose
+{
+  public:
+    int total_vertices_;
+    int total_blocks_;
+
+    // all the X blocks, then all the Y blocks, then all the Z blocks
+    HMM_Vec4 *lanes_;
+
+  public:
+    ModelPose() : total_vertices_(0), total_blocks_(0), lanes_(nullptr)
+    {
+    }
+
+    ~ModelPose()
+    {
+        delete[] lanes_;
+    }
+
+    void Resize(int total_vertices);
+
+    void Set(int v, float x, float y, float z)
+    {
+        lanes_[v >> 2].Elements[v & 3]                       = x;
+        lanes_[total_blocks_ + (v >> 2)].Elements[v & 3]     = y;
+        lanes_[total_blocks_ * 2 + (v >> 2)].Elements[v & 3] = z;
+    }
+
+    float X(int v) const
+    {
+        return lanes_[v >> 2].Elements[v & 3];
+    }
+    float Y(int v) const
+    {
+        return lanes_[total_blocks_ + (v >> 2)].Elements[v & 3];
+    }
+    float Z(int v) const
+    {
+        return lanes_[total_blocks_ * 2 + (v >> 2)].Elements[v & 3];
+    }
+};
+
+// Model space -> world space, the same steps as the per-vertex
+// CalcPos() of the model renderers: scale, mlook tilt, rotation.
+class ModelTransform
+{
+  public:
+    float x_, y_, z_;
+
+    float xy_scale_;
+    float y_scale_; // negative when mirrored
+    float z_scale_;
+    float bias_;
+
+    HMM_Vec2 mouselook_x_matrix_;
+    HMM_Vec2 mouselook_z_matrix_;
+
+    HMM_Vec2 rotation_x_matrix_;
+    HMM_Vec2 rotation_y_matrix_;
+};
+
+// Returns the vertex positions of a model between two frames.  The
+// lerp is quantised, and blends are cached for the rest of the render
+// frame so every instance showing the same pose shares one copy.
+// `model' is only used as part of the cache key.
+const ModelPose *InterpolateModelPose(const void *model, int frame1, int frame2, const ModelPose *pose1,
+                                      const ModelPose *pose2, float lerp);
+
+void TransformModelPose(const ModelPose *src, const ModelTransform *transform, ModelPose *dest);
+
 /* ---- normals ---- */
 
 constexpr uint8_t kTotalMDFormatNormals = 162;
@@ -154,6 +154,9 @@ struct MDLFrame
 
     // list of normals which are used.  Terminated by -1.
     short *used_normals;
+
+    // copy of the vertex positions, laid out for blending
+    ModelPose pose;
 };
 
 struct MDLPoint
@@ -434,6 +437,15 @@ MDLModel *MDLLoad(epi::File *f)
         }
 
         md->frames_[i].used_normals = CreateNormalList(which_normals);
+
+        md->frames_[i].pose.Resize(md->vertices_per_frame_);
+
+        for (int v = 0; v < md->vertices_per_frame_; v++)
+        {
+            MDLVertex *V = md->frames_[i].vertices + v;
+
+            md->frames_[i].pose.Set(v, V->x, V->y, V->z);
+        }
     }
 
     delete[] texcoords;
@@ -471,9 +483,8 @@ class MDLCoordinateData
 
     MDLModel *model_;
 
-    const MDLFrame    *frame1_;
-    const MDLFrame    *frame2_;
-    const MDLTriangle *strip_;
+    const MDLFrame *frame1_;
+    const MDLFrame *frame2_;
 
     float lerp_;
     float x_, y_, z_;
@@ -504,30 +515,16 @@ class MDLCoordinateData
 
     ColorMixer normal_colors_[kTotalMDFormatNormals];
 
+    // world space normals, only valid for the used ones
+    HMM_Vec3 normals_[kTotalMDFormatNormals];
+
     short *used_normals_;
 
     bool is_additive_;
 
   public:
-    void CalculatePosition(HMM_Vec3 *pos, float x1, float y1, float z1) const
+    void CalculateNormal(HMM_Vec3 *normal, short n) const
     {
-        x1 *= xy_scale_;
-        y1 *= xy_scale_;
-        z1 *= z_scale_;
-
-        float x2 = x1 * mouselook_x_vector_.X + z1 * mouselook_x_vector_.Y;
-        float z2 = x1 * mouselook_z_vector_.X + z1 * mouselook_z_vector_.Y;
-        float y2 = y1;
-
-        pos->X = x_ + x2 * rotation_vector_x_.X + y2 * rotation_vector_x_.Y;
-        pos->Y = y_ + x2 * rotation_vector_y_.X + y2 * rotation_vector_y_.Y;
-        pos->Z = z_ + z2;
-    }
-
-    void CalculateNormal(HMM_Vec3 *normal, const MDLVertex *vert) const
-    {
-        short n = vert->normal_idx;
-
         float nx1 = md_normals[n].X;
         float ny1 = md_normals[n].Y;
         float nz1 = md_normals[n].Z;
@@ -542,6 +539,9 @@ class MDLCoordinateData
     }
 };
 
+// world space vertex positions of the model being drawn
+static ModelPose mdl_world_pose;
+
 static void InitializeNormalColors(MDLCoordinateData *data)
 {
     short *n_list = data->used_normals_;
@@ -627,70 +627,93 @@ static void UpdateMulticols(MDLCoordinateData *data)
     }
 }
 
-static inline float LerpIt(float v1, float v2, float lerp)
+static void CalculateNormals(MDLCoordinateData *data)
 {
-    return v1 * (1.0f - lerp) + v2 * lerp;
+    short *n_list = data->used_normals_;
+
+    for (; *n_list >= 0; n_list++)
+        data->CalculateNormal(&data->normals_[*n_list], *n_list);
 }
 
-static inline void ModelCoordFunc(MDLCoordinateData *data, int v_idx, HMM_Vec3 *pos, float *rgb, HMM_Vec2 *texc,
-                                  HMM_Vec3 *normal)
+// positions, normals and texture coords are the same for every pass
+static void ModelGeometryFunc(MDLCoordinateData *data, const ModelPose *pose)
 {
     const MDLModel *md = data->model_;
 
-    const MDLFrame    *frame1 = data->frame1_;
-    const MDLFrame    *frame2 = data->frame2_;
-    const MDLTriangle *strip  = data->strip_;
+    const MDLFrame *n_frame = (data->lerp_ < 0.5) ? data->frame1_ : data->frame2_;
 
-    EPI_ASSERT(strip->first + v_idx >= 0);
-    EPI_ASSERT(strip->first + v_idx < md->total_points_);
+    RendererVertex *dest = md->gl_vertices_;
 
-    const MDLPoint *point = &md->points_[strip->first + v_idx];
+    for (int i = 0; i < md->total_triangles_; i++)
+    {
+        const MDLTriangle *strip = &md->triangles_[i];
 
-    const MDLVertex *vert1 = &frame1->vertices[point->vert_idx];
-    const MDLVertex *vert2 = &frame2->vertices[point->vert_idx];
+        for (int v_idx = 0; v_idx < 3; v_idx++, dest++)
+        {
+            EPI_ASSERT(strip->first + v_idx >= 0);
+            EPI_ASSERT(strip->first + v_idx < md->total_points_);
 
-    float x1 = LerpIt(vert1->x, vert2->x, data->lerp_);
-    float y1 = LerpIt(vert1->y, vert2->y, data->lerp_);
-    float z1 = LerpIt(vert1->z, vert2->z, data->lerp_) + data->bias_;
+            const MDLPoint *point = &md->points_[strip->first + v_idx];
 
-    if (MirrorReflective())
-        y1 = -y1;
+            int v = point->vert_idx;
+
+            dest->position = {{pose->X(v), pose->Y(v), pose->Z(v)}};
+            dest->normal   = data->normals_[n_frame->vertices[v].normal_idx];
+
+            if (data->is_fuzzy_)
+            {
+                dest->texture_coordinates[0].X = point->skin_s * data->fuzz_multiplier_ + data->fuzz_add_.X;
+                dest->texture_coordinates[0].Y = point->skin_t * data->fuzz_multiplier_ + data->fuzz_add_.Y;
+            }
+            else
+            {
+                dest->texture_coordinates[0] = {{point->skin_s, point->skin_t}};
+            }
+        }
+    }
+}
 
-    data->CalculatePosition(pos, x1, y1, z1);
+static void ModelColorFunc(MDLCoordinateData *data, float trans)
+{
+    const MDLModel *md = data->model_;
 
-    const MDLVertex *n_vert = (data->lerp_ < 0.5) ? vert1 : vert2;
+    const MDLFrame *n_frame = (data->lerp_ < 0.5) ? data->frame1_ : data->frame2_;
 
-    data->CalculateNormal(normal, n_vert);
+    RendererVertex *dest = md->gl_vertices_;
 
-    if (data->is_fuzzy_)
+    for (int i = 0; i < md->total_points_; i++, dest++)
     {
-        texc->X = point->skin_s * data->fuzz_multiplier_ + data->fuzz_add_.X;
-        texc->Y = point->skin_t * data->fuzz_multiplier_ + data->fuzz_add_.Y;
+        float *rgb = dest->rgba_color;
 
-        rgb[0] = rgb[1] = rgb[2] = 0;
-        return;
-    }
+        rgb[3] = trans;
 
-    *texc = {{point->skin_s, point->skin_t}};
+        if (data->is_fuzzy_)
+        {
+            rgb[0] = rgb[1] = rgb[2] = 0;
+            continue;
+        }
 
-    ColorMixer *col = &data->normal_colors_[n_vert->normal_idx];
+        const MDLPoint *point = &md->points_[md->triangles_[i / 3].first + (i % 3)];
 
-    if (!data->is_additive_)
-    {
-        rgb[0] = col->modulate_red_ / 255.0;
-        rgb[1] = col->modulate_green_ / 255.0;
-        rgb[2] = col->modulate_blue_ / 255.0;
-    }
-    else
-    {
-        rgb[0] = col->add_red_ / 255.0;
-        rgb[1] = col->add_green_ / 255.0;
-        rgb[2] = col->add_blue_ / 255.0;
-    }
+        ColorMixer *col = &data->normal_colors_[n_frame->vertices[point->vert_idx].normal_idx];
+
+        if (!data->is_additive_)
+        {
+            rgb[0] = col->modulate_red_ / 255.0;
+            rgb[1] = col->modulate_green_ / 255.0;
+            rgb[2] = col->modulate_blue_ / 255.0;
+        }
+        else
+        {
+            rgb[0] = col->add_red_ / 255.0;
+            rgb[1] = col->add_green_ / 255.0;
+            rgb[2] = col->add_blue_ / 255.0;
+        }
 
-    rgb[0] *= render_view_red_multiplier;
-    rgb[1] *= render_view_green_multiplier;
-    rgb[2] *= render_view_blue_multiplier;
+        rgb[0] *= render_view_red_multiplier;
+        rgb[1] *= render_view_green_multiplier;
+        rgb[2] *= render_view_blue_multiplier;
+    }
 }
 
 void MDLRenderModel(MDLModel *md, const Image *skin_img, bool is_weapon, int frame1, int frame2, float lerp, float x,
@@ -849,6 +872,31 @@ void MDLRenderModel(MDLModel *md, const Image *skin_img, bool is_weapon, int fra
         }
     }
 
+    /* compute the geometry */
+
+    ModelTransform transform;
+
+    transform.x_                  = x;
+    transform.y_                  = y;
+    transform.z_                  = z;
+    transform.xy_scale_           = data.xy_scale_;
+    transform.y_scale_            = MirrorReflective() ? -data.xy_scale_ : data.xy_scale_;
+    transform.z_scale_            = data.z_scale_;
+    transform.bias_               = data.bias_;
+    transform.mouselook_x_matrix_ = data.mouselook_x_vector_;
+    transform.mouselook_z_matrix_ = data.mouselook_z_vector_;
+    transform.rotation_x_matrix_  = data.rotation_vector_x_;
+    transform.rotation_y_matrix_  = data.rotation_vector_y_;
+
+    const ModelPose *pose =
+        InterpolateModelPose(md, frame1, frame2, &data.frame1_->pose, &data.frame2_->pose, data.lerp_);
+
+    TransformModelPose(pose, &transform, &mdl_world_pose);
+
+    CalculateNormals(&data);
+
+    ModelGeometryFunc(&data, &mdl_world_pose);
+
     /* draw the model */
 
     int num_pass = data.is_fuzzy_ ? 1 : (detail_level > 0 ? 4 : 3);
@@ -1027,22 +1075,7 @@ void MDLRenderModel(MDLModel *md, const Image *skin_img, bool is_weapon, int fra
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, renderer_dumb_clamp.d_ ? GL_CLAMP : GL_CLAMP_TO_EDGE);
         }
 
-        RendererVertex *start = md->gl_vertices_;
-
-        for (int i = 0; i < md->total_triangles_; i++)
-        {
-            data.strip_ = &md->triangles_[i];
-
-            for (int v_idx = 0; v_idx < 3; v_idx++)
-            {
-                RendererVertex *dest = start + (i * 3) + v_idx;
-
-                ModelCoordFunc(&data, v_idx, &dest->position, dest->rgba_color, &dest->texture_coordinates[0],
-                               &dest->normal);
-
-                dest->rgba_color[3] = trans;
-            }
-        }
+        ModelColorFunc(&data, trans);
 
         // setup client state
         glBindBuffer(GL_ARRAY_BUFFER, md->vertex_buffer_object_);
@@ -30,6 +30,8 @@
 
 #include <math.h>
 
+#include <vector>
+
 #include "AlmostEquals.h"
 #include "dm_defs.h"
 #include "dm_state.h"
@@ -37,6 +39,7 @@
 #include "epi.h"
 #include "epi_doomdefs.h"
 #include "i_defs_gl.h"
+#include "i_system.h"
 #include "m_misc.h"
 #include "n_network.h"
 #include "p_local.h"
@@ -204,24 +207,214 @@ void RendererShutdown(void)
     FreeBSP();
 }
 
-Subsector *PointInSubsector(float x, float y)
+// The subsector grid covers the level with square cells, each holding
+// the deepest BSP node (often a subsector) whose partition lines miss
+// the cell entirely.  PointInSubsector() starts its walk there instead
+// of at the root.
+static constexpr float kSubsectorGridCellSize = 128.0f;
+static constexpr int   kSubsectorGridMaxCells = (1 << 20);
+
+// cells are grown by this much when testing them against partitions,
+// keeping points near a partition line away from rounding trouble
+static constexpr float kSubsectorGridMargin = 1.0f;
+
+static unsigned int *subsector_grid        = nullptr;
+static int           subsector_grid_width  = 0;
+static int           subsector_grid_height = 0;
+static float         subsector_grid_x      = 0;
+static float         subsector_grid_y      = 0;
+static float         subsector_grid_size   = kSubsectorGridCellSize;
+
+static unsigned int SubsectorGridCellNode(float x1, float y1, float x2, float y2)
 {
-    BspNode     *node;
-    int          side;
-    unsigned int nodenum;
+    unsigned int nodenum = root_node;
 
-    nodenum = root_node;
+    while (!(nodenum & kLeafSubsector))
+    {
+        BspNode *node = &level_nodes[nodenum];
+
+        int side = PointOnDividingLineSide(x1, y1, &node->divider);
+
+        if (PointOnDividingLineSide(x2, y1, &node->divider) != side ||
+            PointOnDividingLineSide(x1, y2, &node->divider) != side ||
+            PointOnDividingLineSide(x2, y2, &node->divider) != side)
+        {
+            break;
+        }
+
+        nodenum = node->children[side];
+    }
+
+    return nodenum;
+}
 
+void CreateSubsectorGrid(void)
+{
+    DestroySubsectorGrid();
+
+    if (total_level_vertexes == 0)
+        return;
+
+    float min_x = level_vertexes[0].X;
+    float min_y = level_vertexes[0].Y;
+    float max_x = min_x;
+    float max_y = min_y;
+
+    for (int i = 1; i < total_level_vertexes; i++)
+    {
+        min_x = HMM_MIN(min_x, level_vertexes[i].X);
+        min_y = HMM_MIN(min_y, level_vertexes[i].Y);
+        max_x = HMM_MAX(max_x, level_vertexes[i].X);
+        max_y = HMM_MAX(max_y, level_vertexes[i].Y);
+    }
+
+    subsector_grid_size = kSubsectorGridCellSize;
+
+    for (;;)
+    {
+        subsector_grid_width  = (int)((max_x - min_x) / subsector_grid_size) + 1;
+        subsector_grid_height = (int)((max_y - min_y) / subsector_grid_size) + 1;
+
+        // huge maps get coarser cells
+        if ((int64_t)subsector_grid_width * subsector_grid_height <= kSubsectorGridMaxCells)
+            break;
+
+        subsector_grid_size *= 2.0f;
+    }
+
+    subsector_grid_x = min_x;
+    subsector_grid_y = min_y;
+
+    subsector_grid = new unsigned int[subsector_grid_width * subsector_grid_height];
+
+    for (int gy = 0; gy < subsector_grid_height; gy++)
+    {
+        for (int gx = 0; gx < subsector_grid_width; gx++)
+        {
+            float x1 = subsector_grid_x + gx * subsector_grid_size;
+            float y1 = subsector_grid_y + gy * subsector_grid_size;
+
+            subsector_grid[gy * subsector_grid_width + gx] =
+                SubsectorGridCellNode(x1 - kSubsectorGridMargin, y1 - kSubsectorGridMargin,
+                                      x1 + subsector_grid_size + kSubsectorGridMargin,
+                                      y1 + subsector_grid_size + kSubsectorGridMargin);
+        }
+    }
+}
+
+void DestroySubsectorGrid(void)
+{
+    delete[] subsector_grid;
+    subsector_grid = nullptr;
+
+    subsector_grid_width  = 0;
+    subsector_grid_height = 0;
+}
+
+static unsigned int SubsectorGridStartNode(float x, float y)
+{
+    if (subsector_grid)
+    {
+        float gx = (x - subsector_grid_x) / subsector_grid_size;
+        float gy = (y - subsector_grid_y) / subsector_grid_size;
+
+        // written so that NaN falls through to the root
+        if (gx >= 0 && gy >= 0 && gx < subsector_grid_width && gy < subsector_grid_height)
+            return subsector_grid[(int)gy * subsector_grid_width + (int)gx];
+    }
+
+    return root_node;
+}
+
+static Subsector *PointInSubsectorFrom(unsigned int nodenum, float x, float y)
+{
     while (!(nodenum & kLeafSubsector))
     {
-        node    = &level_nodes[nodenum];
-        side    = PointOnDividingLineSide(x, y, &node->divider);
+        BspNode *node = &level_nodes[nodenum];
+        int      side = PointOnDividingLineSide(x, y, &node->divider);
+
         nodenum = node->children[side];
     }
 
     return &level_subsectors[nodenum & ~kLeafSubsector];
 }
 
+Subsector *PointInSubsector(float x, float y)
+{
+    return PointInSubsectorFrom(SubsectorGridStartNode(x, y), x, y);
+}
+
+//
+// Times PointInSubsector() against a walk from the root of the BSP,
+// for random points around the current level, and checks that both
+// give the same answers.
+//
+void BenchmarkPointInSubsector(int total_points)
+{
+    if (!subsector_grid)
+    {
+        LogPrint("No level loaded.\n");
+        return;
+    }
+
+    total_points = HMM_MAX(1, total_points);
+
+    std::vector<HMM_Vec2> points(total_points);
+
+    uint32_t seed = 0x2545F491;
+
+    float span_x = subsector_grid_width * subsector_grid_size;
+    float span_y = subsector_grid_height * subsector_grid_size;
+
+    for (HMM_Vec2 &point : points)
+    {
+        // xorshift, to leave the game's random numbers alone
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        point.X = subsector_grid_x + (seed & 0xFFFF) * span_x / 65536.0f;
+        point.Y = subsector_grid_y + (seed >> 16) * span_y / 65536.0f;
+    }
+
+    std::vector<Subsector *> from_root(total_points);
+    std::vector<Subsector *> from_grid(total_points);
+
+    uint32_t start = GetMicroseconds();
+
+    for (int i = 0; i < total_points; i++)
+        from_root[i] = PointInSubsectorFrom(root_node, points[i].X, points[i].Y);
+
+    uint32_t root_time = GetMicroseconds() - start;
+
+    start = GetMicroseconds();
+
+    for (int i = 0; i < total_points; i++)
+        from_grid[i] = PointInSubsector(points[i].X, points[i].Y);
+
+    uint32_t grid_time = GetMicroseconds() - start;
+
+    int mismatches = 0;
+
+    for (int i = 0; i < total_points; i++)
+    {
+        if (from_root[i] != from_grid[i])
+            mismatches++;
+    }
+
+    int leaf_cells = 0;
+
+    for (int i = 0; i < subsector_grid_width * subsector_grid_height; i++)
+    {
+        if (subsector_grid[i] & kLeafSubsector)
+            leaf_cells++;
+    }
+
+    LogPrint("PointInSubsector: %d points, %dx%d grid of %d units (%d%% single subsector)\n", total_points,
+             subsector_grid_width, subsector_grid_height, (int)subsector_grid_size,
+             leaf_cells * 100 / (subsector_grid_width * subsector_grid_height));
+    LogPrint("  BSP walk: %u us, grid: %u us, mismatches: %d\n", root_time, grid_time, mismatches);
+}
+
 RegionProperties *GetPointProperties(Subsector *sub, float z)
 {
     Extrafloor *S, *L, *C;
@@ -267,24 +460,8 @@ RegionProperties *GetPointProperties(Subsector *sub, float z)
 
 //----------------------------------------------------------------------------
 
-// large buffers for cache coherency vs allocating each on heap
-static constexpr uint16_t kMaximumDrawThings     = 32768;
-static constexpr uint16_t kMaximumDrawFloors     = 32768;
-static constexpr uint32_t kMaximumDrawSegs       = 65536;
-static constexpr uint32_t kMaximumDrawSubsectors = 65536;
-static constexpr uint16_t kMaximumDrawMirrors    = 512;
-
-static std::vector<DrawThing>     draw_things;
-static std::vector<DrawFloor>     draw_floors;
-static std::vector<DrawSeg>       draw_segs;
-static std::vector<DrawSubsector> draw_subsectors;
-static std::vector<DrawMirror>    draw_mirrors;
-
-static int draw_thing_position;
-static int draw_floor_position;
-static int draw_seg_position;
-static int draw_subsector_position;
-static int draw_mirror_position;
+// the draw structures live in render_frame_arena (see r_arena.h), so
+// there is no limit on how many a view may need.
 
 //
 // AllocateDrawStructs
@@ -293,83 +470,45 @@ static int draw_mirror_position;
 //
 void AllocateDrawStructs(void)
 {
-    draw_things.resize(kMaximumDrawThings);
-    draw_floors.resize(kMaximumDrawFloors);
-    draw_segs.resize(kMaximumDrawSegs);
-    draw_subsectors.resize(kMaximumDrawSubsectors);
-    draw_mirrors.resize(kMaximumDrawMirrors);
+    // the first block is allocated by the first frame
+    render_frame_arena.Free();
 }
 
 // bsp clear function
 
 void ClearBSP(void)
 {
-    draw_thing_position     = 0;
-    draw_floor_position     = 0;
-    draw_seg_position       = 0;
-    draw_subsector_position = 0;
-    draw_mirror_position    = 0;
+    render_frame_arena.Reset();
 }
 
 void FreeBSP(void)
 {
-    draw_things.clear();
-    draw_floors.clear();
-    draw_segs.clear();
-    draw_subsectors.clear();
-    draw_mirrors.clear();
-
-    ClearBSP();
+    render_frame_arena.Free();
 }
 
 DrawThing *GetDrawThing()
 {
-    if (draw_thing_position >= kMaximumDrawThings)
-    {
-        FatalError("Max Draw Things Exceeded");
-    }
-
-    return &draw_things[draw_thing_position++];
+    return render_frame_arena.New<DrawThing>();
 }
 
 DrawFloor *GetDrawFloor()
 {
-    if (draw_floor_position >= kMaximumDrawFloors)
-    {
-        FatalError("Max Draw Floors Exceeded");
-    }
-
-    return &draw_floors[draw_floor_position++];
+    return render_frame_arena.New<DrawFloor>();
 }
 
 DrawSeg *GetDrawSeg()
 {
-    if (draw_seg_position >= kMaximumDrawSegs)
-    {
-        FatalError("Max Draw Segs Exceeded");
-    }
-
-    return &draw_segs[draw_seg_position++];
+    return render_frame_arena.New<DrawSeg>();
 }
 
 DrawSubsector *GetDrawSub()
 {
-    if (draw_subsector_position >= kMaximumDrawSubsectors)
-    {
-        FatalError("Max Draw Subs Exceeded");
-    }
-
-    return &draw_subsectors[draw_subsector_position++];
+    return render_frame_arena.New<DrawSubsector>();
 }
 
 DrawMirror *GetDrawMirror()
 {
-    if (draw_mirror_position >= kMaximumDrawMirrors)
-    {
-        FatalError("Max Draw Mirrors Exceeded");
-    }
-
-    return &draw_mirrors[draw_mirror_position++];
+    return render_frame_arena.New<DrawMirror>();
 }
 
 //--- editor settings ---
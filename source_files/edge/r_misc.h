@@ -78,6 +78,9 @@ extern float sine_table[kSineTableSize];
 BAMAngle          PointToAngle(float x1, float y1, float x2, float y2, bool precise = false);
 float             PointToDistance(float x1, float y1, float x2, float y2);
 Subsector        *PointInSubsector(float x, float y);
+void              CreateSubsectorGrid(void);
+void              DestroySubsectorGrid(void);
+void              BenchmarkPointInSubsector(int total_points);
 RegionProperties *GetPointProperties(Subsector *sub, float z);
 
 //
@@ -18,12 +18,25 @@
 
 #include "r_occlude.h"
 
+#include <string.h>
+
+#include "con_var.h"
 #include "ddf_types.h"
 #include "epi.h"
 #include "epi_bam.h"
 
 // #define EDGE_DEBUG_OCCLUSION 1
 
+// 1 = fixed resolution bitset (default), 0 = the old sorted range list.
+// Only looked at in OcclusionClear(), so it never changes mid-frame.
+EDGE_DEFINE_CONSOLE_VARIABLE(renderer_occlusion_bitset, "1", kConsoleVariableFlagNone)
+
+static bool occlusion_use_bitset = true;
+
+//----------------------------------------------------------------------------
+//  RANGE LIST
+//----------------------------------------------------------------------------
+
 struct AngleRange
 {
     BAMAngle low, high;
@@ -72,11 +85,8 @@ static void ValidateBuffer(void)
 }
 #endif // DEBUG_OCCLUSION
 
-void OcclusionClear(void)
+static void ListClear(void)
 {
-    // Clear all angles in the whole buffer
-    // (i.e. mark them as open / non-blocking).
-
     if (occlusion_buffer_head)
     {
         occlusion_buffer_tail->next = free_occlusion_range;
@@ -159,7 +169,7 @@ static inline void RemoveRange(AngleRange *R)
     free_occlusion_range = R;
 }
 
-static void DoSet(BAMAngle low, BAMAngle high)
+static void ListSet(BAMAngle low, BAMAngle high)
 {
     for (AngleRange *AR = occlusion_buffer_head; AR; AR = AR->next)
     {
@@ -205,6 +215,151 @@ static void DoSet(BAMAngle low, BAMAngle high)
     LinkInTail(GetNewRange(low, high));
 }
 
+static inline bool ListTest(BAMAngle low, BAMAngle high)
+{
+    for (AngleRange *AR = occlusion_buffer_head; AR; AR = AR->next)
+    {
+        if (AR->low <= low && high <= AR->high)
+            return true;
+
+        if (AR->high > low)
+            break;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------
+//  BITSET
+//----------------------------------------------------------------------------
+
+// The full circle is split into 2^18 bins (each about 0.0014 degrees,
+// well under a pixel even when zoomed), one bit per bin.  A second level
+// has one bit per 64-bit word which is set when that word is full, so
+// testing a wide span mostly looks at the summary words.
+//
+// Range ends are rounded to the nearest bin edge.  Neighbouring walls
+// which share an end angle therefore merge seamlessly, at the cost of
+// being up to half a bin off, which is never visible.
+
+static constexpr int kOcclusionBinShift     = 14;
+static constexpr int kOcclusionBins         = 1 << (32 - kOcclusionBinShift);
+static constexpr int kOcclusionWords        = kOcclusionBins / 64;
+static constexpr int kOcclusionSummaryWords = kOcclusionWords / 64;
+
+static uint64_t occlusion_bits[kOcclusionWords];
+static uint64_t occlusion_full_words[kOcclusionSummaryWords];
+
+static inline int BinEdge(BAMAngle ang)
+{
+    return (int)(((uint64_t)ang + (1 << (kOcclusionBinShift - 1))) >> kOcclusionBinShift);
+}
+
+// bits lo..hi (inclusive) of a word
+static inline uint64_t BitMask(int lo, int hi)
+{
+    return (~(uint64_t)0 >> (63 - hi)) & (~(uint64_t)0 << lo);
+}
+
+static inline bool AllBitsSet(const uint64_t *words, int first, int last)
+{
+    int fw = first >> 6;
+    int lw = last >> 6;
+
+    if (fw == lw)
+    {
+        uint64_t mask = BitMask(first & 63, last & 63);
+        return (words[fw] & mask) == mask;
+    }
+
+    uint64_t mask = BitMask(first & 63, 63);
+    if ((words[fw] & mask) != mask)
+        return false;
+
+    mask = BitMask(0, last & 63);
+    if ((words[lw] & mask) != mask)
+        return false;
+
+    for (int w = fw + 1; w < lw; w++)
+        if (words[w] != ~(uint64_t)0)
+            return false;
+
+    return true;
+}
+
+static void BitsetClear(void)
+{
+    memset(occlusion_bits, 0, sizeof(occlusion_bits));
+    memset(occlusion_full_words, 0, sizeof(occlusion_full_words));
+}
+
+static void BitsetSet(BAMAngle low, BAMAngle high)
+{
+    int first = BinEdge(low);
+    int last  = BinEdge(high) - 1;
+
+    if (first > last)
+        return;
+
+    int fw = first >> 6;
+    int lw = last >> 6;
+
+    for (int w = fw; w <= lw; w++)
+    {
+        uint64_t mask = BitMask((w == fw) ? (first & 63) : 0, (w == lw) ? (last & 63) : 63);
+
+        occlusion_bits[w] |= mask;
+
+        if (occlusion_bits[w] == ~(uint64_t)0)
+            occlusion_full_words[w >> 6] |= (uint64_t)1 << (w & 63);
+    }
+}
+
+static bool BitsetTest(BAMAngle low, BAMAngle high)
+{
+    int first = BinEdge(low);
+    int last  = BinEdge(high) - 1;
+
+    // narrower than a bin: use the bin it lies in
+    if (first > last)
+    {
+        first = last = (int)(low >> kOcclusionBinShift);
+    }
+
+    int fw = first >> 6;
+    int lw = last >> 6;
+
+    if (lw - fw < 2)
+        return AllBitsSet(occlusion_bits, first, last);
+
+    // check the partial words at each end, and the summary bits for
+    // all the words in between.
+    uint64_t mask = BitMask(first & 63, 63);
+    if ((occlusion_bits[fw] & mask) != mask)
+        return false;
+
+    mask = BitMask(0, last & 63);
+    if ((occlusion_bits[lw] & mask) != mask)
+        return false;
+
+    return AllBitsSet(occlusion_full_words, fw + 1, lw - 1);
+}
+
+//----------------------------------------------------------------------------
+
+void OcclusionClear(void)
+{
+    // Clear all angles in the whole buffer
+    // (i.e. mark them as open / non-blocking).
+
+    occlusion_use_bitset = (renderer_occlusion_bitset.d_ != 0);
+
+    if (occlusion_use_bitset)
+        BitsetClear();
+    else
+        ListClear();
+}
+
 void OcclusionSet(BAMAngle low, BAMAngle high)
 {
     // Set all angles in the given range, i.e. mark them as blocking.
@@ -212,12 +367,24 @@ void OcclusionSet(BAMAngle low, BAMAngle high)
 
     EPI_ASSERT((BAMAngle)(high - low) < kBAMAngle180);
 
+    if (occlusion_use_bitset)
+    {
+        if (low <= high)
+            BitsetSet(low, high);
+        else
+        {
+            BitsetSet(low, kBAMAngle360);
+            BitsetSet(0, high);
+        }
+        return;
+    }
+
     if (low <= high)
-        DoSet(low, high);
+        ListSet(low, high);
     else
     {
-        DoSet(low, kBAMAngle360);
-        DoSet(0, high);
+        ListSet(low, kBAMAngle360);
+        ListSet(0, high);
     }
 
 #ifdef EDGE_DEBUG_OCCLUSION
@@ -225,20 +392,6 @@ void OcclusionSet(BAMAngle low, BAMAngle high)
 #endif
 }
 
-static inline bool DoTest(BAMAngle low, BAMAngle high)
-{
-    for (AngleRange *AR = occlusion_buffer_head; AR; AR = AR->next)
-    {
-        if (AR->low <= low && high <= AR->high)
-            return true;
-
-        if (AR->high > low)
-            break;
-    }
-
-    return false;
-}
-
 bool OcclusionTest(BAMAngle low, BAMAngle high)
 {
     // Check whether all angles in the given range are set (i.e. blocked).
@@ -247,10 +400,18 @@ bool OcclusionTest(BAMAngle low, BAMAngle high)
 
     EPI_ASSERT((BAMAngle)(high - low) < kBAMAngle180);
 
+    if (occlusion_use_bitset)
+    {
+        if (low <= high)
+            return BitsetTest(low, high);
+        else
+            return BitsetTest(low, kBAMAngle360) && BitsetTest(0, high);
+    }
+
     if (low <= high)
-        return DoTest(low, high);
+        return ListTest(low, high);
     else
-        return DoTest(low, kBAMAngle360) && DoTest(0, high);
+        return ListTest(low, kBAMAngle360) && ListTest(0, high);
 }
 
 //--- editor settings ---
@@ -25,15 +25,17 @@
 
 #include <math.h>
 
-#include <unordered_map>
 #include <unordered_set>
 
 #include "AlmostEquals.h"
+#include "am_map.h"
 #include "dm_defs.h"
 #include "dm_state.h"
+#include "e_profile.h"
 #include "edge_profiling.h"
 #include "epi.h"
 #include "epi_doomdefs.h"
+#include "epi_thread.h"
 #include "g_game.h"
 #include "i_defs_gl.h"
 #include "m_bbox.h"
@@ -64,10 +66,15 @@ static constexpr uint8_t kMaximumPolygonVertices = 64;
 EDGE_DEFINE_CONSOLE_VARIABLE(debug_hall_of_mirrors, "0", kConsoleVariableFlagCheat)
 EDGE_DEFINE_CONSOLE_VARIABLE(force_flat_lighting, "0", kConsoleVariableFlagArchive)
 
+// build the solid walls and planes on the worker threads
+EDGE_DEFINE_CONSOLE_VARIABLE(renderer_parallel_build, "1", kConsoleVariableFlagArchive)
+
 extern ConsoleVariable draw_culling;
 
-static Sector *front_sector;
-static Sector *back_sector;
+// the per-subsector state below is thread_local, since the solid
+// walls and planes can be built on worker threads (RenderSubList).
+static thread_local Sector *front_sector;
+static thread_local Sector *back_sector;
 
 unsigned int root_node;
 
@@ -76,8 +83,8 @@ int use_dynamic_lights = 0;
 
 std::unordered_set<AbstractShader *> seen_dynamic_lights;
 
-static int  swirl_pass   = 0;
-static bool thick_liquid = false;
+static thread_local int  swirl_pass   = 0;
+static thread_local bool thick_liquid = false;
 
 float view_x_slope;
 float view_y_slope;
@@ -109,14 +116,78 @@ extern float sprite_skew;
 
 // common stuff
 
-static Subsector *current_subsector;
-static Seg       *current_seg;
+static thread_local Subsector *current_subsector;
+static thread_local Seg       *current_seg;
 
 static bool solid_mode;
 
-static std::list<DrawSubsector *> draw_subsector_list;
+static FrameList<DrawSubsector *> draw_subsector_list;
+
+// images looked up this frame: an open addressed table allocated in
+// render_frame_arena.  Growing it just leaves the old table behind
+// until the arena is reset.
+class FrameTextureSlot
+{
+  public:
+    const Image *image_;
+    GLuint       tex_id_;
+};
+
+static FrameTextureSlot *frame_texture_slots = nullptr;
+static int               frame_texture_mask  = 0;
+static int               frame_texture_count = 0;
+
+static void FrameTextureReset(int size)
+{
+    frame_texture_slots = render_frame_arena.NewArray<FrameTextureSlot>(size);
+    frame_texture_mask  = size - 1;
+    frame_texture_count = 0;
+
+    for (int i = 0; i < size; i++)
+        frame_texture_slots[i].image_ = nullptr;
+}
+
+// returns the slot holding the image, or the empty slot where it goes
+static FrameTextureSlot *FrameTextureFind(const Image *image)
+{
+    uint32_t hash = (uint32_t)((uintptr_t)image >> 4) * 0x9E3779B1u;
+
+    for (int i = (int)(hash >> 8) & frame_texture_mask;; i = (i + 1) & frame_texture_mask)
+    {
+        FrameTextureSlot *slot = &frame_texture_slots[i];
+
+        if (slot->image_ == image || slot->image_ == nullptr)
+            return slot;
+    }
+}
+
+static void FrameTextureInsert(const Image *image, GLuint tex_id)
+{
+    // keep the table at most half full
+    if ((frame_texture_count + 1) * 2 > frame_texture_mask + 1)
+    {
+        FrameTextureSlot *old_slots = frame_texture_slots;
+        int               old_size  = frame_texture_mask + 1;
 
-static std::unordered_map<const Image *, GLuint> frame_texture_ids;
+        FrameTextureReset(old_size * 2);
+
+        for (int i = 0; i < old_size; i++)
+        {
+            if (old_slots[i].image_ != nullptr)
+            {
+                *FrameTextureFind(old_slots[i].image_) = old_slots[i];
+                frame_texture_count++;
+            }
+        }
+    }
+
+    FrameTextureSlot *slot = FrameTextureFind(image);
+
+    slot->image_  = image;
+    slot->tex_id_ = tex_id;
+
+    frame_texture_count++;
+}
 
 // ========= MIRROR STUFF ===========
 
@@ -444,16 +515,20 @@ static void MirrorPop()
 static GLuint R_ImageCache(const Image *image, bool anim = true, const Colormap *trans = nullptr)
 {
     // (need to load the image to know the opacity)
-    auto frameid = frame_texture_ids.find(image);
-    if (frameid == frame_texture_ids.end())
+    FrameTextureSlot *slot = FrameTextureFind(image);
+    if (slot->image_ == nullptr)
     {
+        // loading the image is main thread work
+        if (UnitRecordingHazard())
+            return 0;
+
         GLuint tex_id = ImageCache(image, true, render_view_effect_colormap);
-        frame_texture_ids.emplace(image, tex_id);
+        FrameTextureInsert(image, tex_id);
         return tex_id;
     }
     else
     {
-        return frameid->second;
+        return slot->tex_id_;
     }
 }
 
@@ -812,7 +887,7 @@ static void DrawWallPart(DrawFloor *dfloor, float x1, float y1, float lz1, float
     // Note: tex_x1 and tex_x2 are in world coordinates.
     //       top, bottom and tex_top_h as well.
 
-    ec_frame_stats.draw_wall_parts++;
+    UnitFrameStats().draw_wall_parts++;
 
     (void)opaque;
 
@@ -1378,12 +1453,12 @@ static void ComputeWallTiles(Seg *seg, DrawFloor *dfloor, int sidenum, float f_m
         }
     }
 
-    if (sd->middle.fog_wall && draw_culling.d_)
+    if (sd->middle.fog_wall && draw_culling.d_ && sd->middle.image && !UnitRecordingHazard())
         sd->middle.image = nullptr; // Don't delete image in case culling is toggled again
 
     if (!sd->middle.image && !draw_culling.d_)
     {
-        if (sec_fc == kRGBANoValue && other_fc != kRGBANoValue)
+        if (sec_fc == kRGBANoValue && other_fc != kRGBANoValue && !UnitRecordingHazard())
         {
             Image *fw               = (Image *)ImageForFogWall(other_fc);
             fw->opacity_            = kOpacityComplex;
@@ -1391,7 +1466,7 @@ static void ComputeWallTiles(Seg *seg, DrawFloor *dfloor, int sidenum, float f_m
             sd->middle.translucency = other_fd * 100;
             sd->middle.fog_wall     = true;
         }
-        else if (sec_fc != kRGBANoValue && other_fc != sec_fc)
+        else if (sec_fc != kRGBANoValue && other_fc != sec_fc && !UnitRecordingHazard())
         {
             Image *fw               = (Image *)ImageForFogWall(sec_fc);
             fw->opacity_            = kOpacityComplex;
@@ -1467,8 +1542,15 @@ static void ComputeWallTiles(Seg *seg, DrawFloor *dfloor, int sidenum, float f_m
             // light levels - Dasho
             if (dfloor->extrafloor && seg->sidedef->sector->tag == dfloor->extrafloor->sector->tag)
             {
-                dfloor->properties->light_level              = dfloor->extrafloor->properties->light_level;
-                seg->sidedef->sector->properties.light_level = dfloor->extrafloor->properties->light_level;
+                int ef_light = dfloor->extrafloor->properties->light_level;
+
+                if ((dfloor->properties->light_level != ef_light ||
+                     seg->sidedef->sector->properties.light_level != ef_light) &&
+                    !UnitRecordingHazard())
+                {
+                    dfloor->properties->light_level              = ef_light;
+                    seg->sidedef->sector->properties.light_level = ef_light;
+                }
             }
 
             AddWallTile2(seg, dfloor, &sd->bottom, lz1, lz2, rz1, rz2,
@@ -1927,7 +2009,11 @@ static void RenderSeg(DrawFloor *dfloor, Seg *seg, bool mirror_sub = false)
     EPI_ASSERT(!seg->miniseg && seg->linedef);
 
     // mark the segment on the automap
-    seg->linedef->flags |= kLineFlagMapped;
+    if (!(seg->linedef->flags & kLineFlagMapped) && !UnitRecordingHazard())
+    {
+        seg->linedef->flags |= kLineFlagMapped;
+        automap_changes++;
+    }
 
     front_sector = seg->front_subsector->sector;
     back_sector  = nullptr;
@@ -2009,13 +2095,12 @@ static void RendererWalkMirror(DrawSubsector *dsub, Seg *seg, BAMAngle left, BAM
 {
     DrawMirror *mir = GetDrawMirror();
     mir->seg        = seg;
-    mir->draw_subsectors.clear();
 
     mir->left      = view_angle + left;
     mir->right     = view_angle + right;
     mir->is_portal = is_portal;
 
-    dsub->mirrors.push_back(mir);
+    dsub->mirrors.PushBack(render_frame_arena, mir);
 
 #if defined(EDGE_GL_ES2)
     // GL4ES mirror fix for renderlist
@@ -2204,7 +2289,7 @@ static void RendererWalkSeg(DrawSubsector *dsub, Seg *seg)
     DrawSeg *dseg = GetDrawSeg();
     dseg->seg     = seg;
 
-    dsub->segs.push_back(dseg);
+    dsub->segs.PushBack(render_frame_arena, dseg);
 
     Sector *fsector = seg->front_subsector->sector;
     Sector *bsector = nullptr;
@@ -2400,7 +2485,7 @@ static void RenderPlane(DrawFloor *dfloor, float h, MapSurface *surf, int face_d
     if (EDGE_IMAGE_IS_SKY(*surf))
         return;
 
-    ec_frame_stats.draw_planes++;
+    UnitFrameStats().draw_planes++;
 
     RegionProperties *props = dfloor->properties;
 
@@ -2633,7 +2718,7 @@ static inline void AddNewDrawFloor(DrawSubsector *dsub, Extrafloor *ef, float fl
 
     // link it in, height order
 
-    dsub->floors.push_back(dfloor);
+    dsub->floors.PushBack(render_frame_arena, dfloor);
 
     // link it in, rendering order (very important)
 
@@ -2690,10 +2775,6 @@ static void RendererWalkSubsector(int num)
     K->sorted        = false;
     K->render_floors = nullptr;
 
-    K->floors.clear();
-    K->segs.clear();
-    K->mirrors.clear();
-
     UpdateSectorInterpolation(sector);
 
     // --- handle sky (using the depth buffer) ---
@@ -2791,8 +2872,8 @@ static void RendererWalkSubsector(int num)
 
     AddNewDrawFloor(K, nullptr, floor_h, ceil_h, ceil_h, floor_s, ceil_s, props);
 
-    K->floors[0]->is_lowest                     = true;
-    K->floors[K->floors.size() - 1]->is_highest = true;
+    K->floors.First()->is_lowest = true;
+    K->floors.Last()->is_highest = true;
 
     // handle each sprite in the subsector.  Must be done before walls,
     // since the wall code will update the 1D occlusion buffer.
@@ -2833,9 +2914,9 @@ static void RendererWalkSubsector(int num)
 
             // add drawsub to list (closest -> furthest)
             if (total_active_mirrors > 0)
-                active_mirrors[total_active_mirrors - 1].draw_mirror_->draw_subsectors.push_back(K);
+                active_mirrors[total_active_mirrors - 1].draw_mirror_->draw_subsectors.PushBack(render_frame_arena, K);
             else
-                draw_subsector_list.push_back(K);
+                draw_subsector_list.PushBack(render_frame_arena, K);
         }
     }
     else
@@ -2852,24 +2933,202 @@ static void RendererWalkSubsector(int num)
 
         // add drawsub to list (closest -> furthest)
         if (total_active_mirrors > 0)
-            active_mirrors[total_active_mirrors - 1].draw_mirror_->draw_subsectors.push_back(K);
+            active_mirrors[total_active_mirrors - 1].draw_mirror_->draw_subsectors.PushBack(render_frame_arena, K);
         else
-            draw_subsector_list.push_back(K);
+            draw_subsector_list.PushBack(render_frame_arena, K);
     }
 }
 
 static void RenderSubsector(DrawSubsector *dsub, bool mirror_sub = false);
 
-static void RenderSubList(std::list<DrawSubsector *> &dsubs, bool for_mirror = false)
+//
+// Parallel building of the solid pass.
+//
+// The draw list is split into contiguous ranges, and each worker
+// records the units of its range (see r_units).  Anything which only
+// the main thread may do (loading images, creating shaders, dynamic
+// lights, mirrors, changing level data) spoils the subsector being
+// recorded, which is then rendered normally by the main thread when
+// the ranges are replayed in draw order.  The resulting batch is
+// identical to the one built by the plain loop.
+//
+
+static constexpr int kMinimumBuildJobSubsectors = 32;
+
+// one contiguous range of the draw list
+class SubsectorBuildJob
+{
+  public:
+    int first_;
+    int last_;
+
+    UnitRecording *recording_;
+
+    // unit mark after each subsector, or -1 for spoiled ones
+    std::vector<int> unit_ends_;
+
+  public:
+    SubsectorBuildJob() : first_(0), last_(0), recording_(CreateUnitRecording()), unit_ends_()
+    {
+    }
+
+    ~SubsectorBuildJob()
+    {
+    }
+};
+
+static std::vector<DrawSubsector *>     build_subsectors;
+static std::vector<SubsectorBuildJob *> build_jobs;
+
+static void PrepareBuildSurface(const MapSurface *surf)
+{
+    if (surf->image && !EDGE_IMAGE_IS_SKY(*surf))
+        R_ImageCache(surf->image);
+}
+
+// Loads the images and colormap shaders which the subsector is likely
+// to need, so that the workers can find them.  Anything missed here
+// just sends the subsector back to the main thread.
+static void PrepareBuildSubsector(DrawSubsector *dsub)
+{
+    Sector *sec = dsub->subsector->sector;
+
+    for (DrawFloor *dfloor = dsub->render_floors; dfloor != nullptr; dfloor = dfloor->render_next)
+    {
+        GetColormapShader(dfloor->properties, 0, sec);
+
+        PrepareBuildSurface(dfloor->floor);
+        PrepareBuildSurface(dfloor->ceiling);
+    }
+
+    for (DrawSeg *dseg : dsub->segs)
+    {
+        Seg  *seg = dseg->seg;
+        Side *sd  = seg->sidedef;
+
+        if (!sd)
+            continue;
+
+        PrepareBuildSurface(&sd->middle);
+
+        if (!seg->back_subsector)
+            continue;
+
+        Sector *other = seg->back_subsector->sector;
+
+        if (!AlmostEquals(other->floor_height, sec->floor_height))
+        {
+            PrepareBuildSurface(&sd->bottom);
+            PrepareBuildSurface(&other->floor);
+        }
+
+        if (!AlmostEquals(other->ceiling_height, sec->ceiling_height))
+        {
+            PrepareBuildSurface(&sd->top);
+            PrepareBuildSurface(&other->ceiling);
+        }
+    }
+}
+
+static void BuildSubsectorJob(int index, void *userdata)
+{
+    (void)userdata;
+
+    SubsectorBuildJob *job = build_jobs[index];
+
+    job->unit_ends_.clear();
+
+    StartUnitRecording(job->recording_);
+
+    for (int i = job->first_; i < job->last_; i++)
+    {
+        int          mark  = UnitRecordingMark();
+        ECFrameStats stats = UnitFrameStats();
+
+        RenderSubsector(build_subsectors[i]);
+
+        if (UnitRecordingSpoiled())
+        {
+            UnitRecordingRewind(mark);
+            UnitFrameStats() = stats;
+
+            job->unit_ends_.push_back(-1);
+        }
+        else
+            job->unit_ends_.push_back(UnitRecordingMark());
+    }
+
+    StopUnitRecording();
+}
+
+static void RenderSolidParallel(FrameList<DrawSubsector *> &dsubs)
+{
+    EDGE_ZoneScoped;
+
+    build_subsectors.clear();
+
+    for (DrawSubsector *dsub : dsubs)
+        build_subsectors.push_back(dsub);
+
+    for (DrawSubsector *dsub : build_subsectors)
+        PrepareBuildSubsector(dsub);
+
+    int total = (int)build_subsectors.size();
+    int count = HMM_MIN((epi::ThreadPoolWorkers() + 1) * 4, total / kMinimumBuildJobSubsectors);
+
+    while ((int)build_jobs.size() < count)
+        build_jobs.push_back(new SubsectorBuildJob());
+
+    for (int j = 0; j < count; j++)
+    {
+        build_jobs[j]->first_ = (int)((int64_t)total * j / count);
+        build_jobs[j]->last_  = (int)((int64_t)total * (j + 1) / count);
+    }
+
+    epi::ParallelFor(count, BuildSubsectorJob, nullptr);
+
+    // merge everything in draw order
+    for (int j = 0; j < count; j++)
+    {
+        SubsectorBuildJob *job = build_jobs[j];
+
+        int unit = 0;
+
+        for (int i = job->first_; i < job->last_; i++)
+        {
+            int end = job->unit_ends_[i - job->first_];
+
+            if (end < 0)
+            {
+                RenderSubsector(build_subsectors[i]);
+            }
+            else
+            {
+                ReplayUnitRecording(job->recording_, unit, end);
+                unit = end;
+            }
+        }
+
+        MergeUnitRecordingStats(job->recording_);
+    }
+}
+
+static void RenderSubList(FrameList<DrawSubsector *> &dsubs, bool for_mirror = false)
 {
     // draw all solid walls and planes
     solid_mode = true;
     StartUnitBatch(solid_mode);
 
-    std::list<DrawSubsector *>::iterator FI; // Forward Iterator
-
-    for (FI = dsubs.begin(); FI != dsubs.end(); FI++)
-        RenderSubsector(*FI, for_mirror);
+    if (renderer_parallel_build.d_ && !for_mirror && total_active_mirrors == 0 && epi::ThreadPoolWorkers() > 0 &&
+        dsubs.Size() >= 2 * kMinimumBuildJobSubsectors)
+    {
+        RenderSolidParallel(dsubs);
+    }
+    else
+    {
+        for (DrawSubsector *dsub : dsubs)
+            RenderSubsector(dsub, for_mirror);
+    }
 
     FinishUnitBatch();
 
@@ -2877,9 +3136,7 @@ static void RenderSubList(std::list<DrawSubsector *> &dsubs, bool for_mirror = f
     solid_mode = false;
     StartUnitBatch(solid_mode);
 
-    std::list<DrawSubsector *>::reverse_iterator RI;
-
-    for (RI = dsubs.rbegin(); RI != dsubs.rend(); RI++)
+    for (FrameList<DrawSubsector *>::Iterator RI = dsubs.rbegin(); RI != dsubs.rend(); ++RI)
         RenderSubsector(*RI, for_mirror);
 
     FinishUnitBatch();
@@ -3013,7 +3270,11 @@ static void DrawPortalPolygon(DrawMirror *mir)
 static void RenderMirror(DrawMirror *mir)
 {
     // mark the segment on the automap
-    mir->seg->linedef->flags |= kLineFlagMapped;
+    if (!(mir->seg->linedef->flags & kLineFlagMapped))
+    {
+        mir->seg->linedef->flags |= kLineFlagMapped;
+        automap_changes++;
+    }
 
     FinishUnitBatch();
 
@@ -3054,13 +3315,11 @@ static void RenderSubsector(DrawSubsector *dsub, bool mirror_sub)
 
     current_subsector = sub;
 
-    if (solid_mode)
+    if (solid_mode && !dsub->mirrors.Empty() && !UnitRecordingHazard())
     {
-        std::list<DrawMirror *>::iterator MRI;
-
-        for (MRI = dsub->mirrors.begin(); MRI != dsub->mirrors.end(); MRI++)
+        for (DrawMirror *mir : dsub->mirrors)
         {
-            RenderMirror(*MRI);
+            RenderMirror(mir);
         }
     }
 
@@ -3071,10 +3330,9 @@ static void RenderSubsector(DrawSubsector *dsub, bool mirror_sub)
     // handle each floor, drawing planes and things
     for (dfloor = dsub->render_floors; dfloor != nullptr; dfloor = dfloor->render_next)
     {
-        for (std::list<DrawSeg *>::iterator iter = dsub->segs.begin(), iter_end = dsub->segs.end(); iter != iter_end;
-             iter++)
+        for (DrawSeg *dseg : dsub->segs)
         {
-            RenderSeg(dfloor, (*iter)->seg, mirror_sub);
+            RenderSeg(dfloor, dseg->seg, mirror_sub);
         }
 
         RenderPlane(dfloor, dfloor->ceiling_height, dfloor->ceiling, -1);
@@ -3184,7 +3442,7 @@ static void RenderTrueBsp(void)
     ClearBSP();
     OcclusionClear();
 
-    draw_subsector_list.clear();
+    draw_subsector_list.Clear();
 
     Player *v_player = view_camera_map_object->player_;
 
@@ -3193,8 +3451,7 @@ static void RenderTrueBsp(void)
 
     SetupMatrices3d();
 
-    frame_texture_ids.clear();
-    frame_texture_ids.reserve(1024);
+    FrameTextureReset(1024);
 
     glClear(GL_DEPTH_BUFFER_BIT);
     glEnable(GL_DEPTH_TEST);
@@ -3203,7 +3460,11 @@ static void RenderTrueBsp(void)
     BeginSky();
 
     // walk the bsp tree
-    RendererWalkBspNode(root_node);
+    {
+        EDGE_ProfileScope(kProfileTimerBSPWalk);
+
+        RendererWalkBspNode(root_node);
+    }
 
     FinishSky();
 
@@ -204,6 +204,8 @@ static FakeSkybox fake_box[2] = {
     {nullptr, nullptr, 1, {0, 0, 0, 0, 0, 0}, {nullptr, nullptr, nullptr, nullptr, nullptr, nullptr}},
     {nullptr, nullptr, 1, {0, 0, 0, 0, 0, 0}, {nullptr, nullptr, nullptr, nullptr, nullptr, nullptr}}};
 
+static void DeleteSkyMeshes(void);
+
 static void DeleteSkyTexGroup(int SK)
 {
     for (int i = 0; i < 6; i++)
@@ -225,6 +227,8 @@ void DeleteSkyTextures(void)
 
         DeleteSkyTexGroup(SK);
     }
+
+    DeleteSkyMeshes();
 }
 
 static void SetupSkyMatrices(void)
@@ -323,11 +327,114 @@ static void BuildSkyCircle()
     }
 }
 
+//
+// The tessellated cylinder and the skybox faces only depend on the sky
+// image, the stretch mode and the far clip distance, so their vertices
+// are built once into a buffer object and redrawn from there until one
+// of those changes.
+//
+class SkyMesh
+{
+  public:
+    GLuint vertex_buffer_object_ = 0;
+    int    total_vertices_       = 0;
+
+    // what the vertices were built for
+    const Image *image_   = nullptr;
+    SkyStretch   stretch_ = kSkyStretchUnset;
+    float        dist_    = 0;
+    float        v0_      = 0;
+};
+
+static SkyMesh sky_cylinder_mesh;
+static SkyMesh sky_box_mesh;
+
+// vertices of the mesh being built
+static std::vector<RendererVertex> sky_mesh_vertices;
+
+static void AddSkyVertex(float x, float y, float z, float u, float v, float alpha)
+{
+    RendererVertex vert;
+
+    vert.rgba_color[0] = 1.0f;
+    vert.rgba_color[1] = 1.0f;
+    vert.rgba_color[2] = 1.0f;
+    vert.rgba_color[3] = alpha;
+
+    vert.position               = {{x, y, z}};
+    vert.texture_coordinates[0] = {{u, v}};
+    vert.texture_coordinates[1] = {{0, 0}};
+    vert.normal                 = {{0, 0, 0}};
+
+    sky_mesh_vertices.push_back(vert);
+}
+
+static void UploadSkyMesh(SkyMesh &mesh)
+{
+    if (mesh.vertex_buffer_object_ == 0)
+        glGenBuffers(1, &mesh.vertex_buffer_object_);
+
+    glBindBuffer(GL_ARRAY_BUFFER, mesh.vertex_buffer_object_);
+    glBufferData(GL_ARRAY_BUFFER, sky_mesh_vertices.size() * sizeof(RendererVertex), sky_mesh_vertices.data(),
+                 GL_STATIC_DRAW);
+
+    mesh.total_vertices_ = (int)sky_mesh_vertices.size();
+
+    sky_mesh_vertices.clear();
+}
+
+static void BindSkyMesh(const SkyMesh &mesh, bool use_colors)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, mesh.vertex_buffer_object_);
+
+    glVertexPointer(3, GL_FLOAT, sizeof(RendererVertex), (void *)(offsetof(RendererVertex, position.X)));
+    glEnableClientState(GL_VERTEX_ARRAY);
+
+    // without the color array the current glColor is used
+    if (use_colors)
+    {
+        glColorPointer(4, GL_FLOAT, sizeof(RendererVertex), (void *)(offsetof(RendererVertex, rgba_color)));
+        glEnableClientState(GL_COLOR_ARRAY);
+    }
+    else
+        glDisableClientState(GL_COLOR_ARRAY);
+
+    glNormalPointer(GL_FLOAT, sizeof(RendererVertex), (void *)(offsetof(RendererVertex, normal.X)));
+    glEnableClientState(GL_NORMAL_ARRAY);
+
+    glClientActiveTexture(GL_TEXTURE0);
+    glTexCoordPointer(2, GL_FLOAT, sizeof(RendererVertex), (void *)(offsetof(RendererVertex, texture_coordinates[0])));
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+}
+
+static void UnbindSkyMesh(void)
+{
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_NORMAL_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+static void DeleteSkyMeshes(void)
+{
+    SkyMesh *meshes[2] = {&sky_cylinder_mesh, &sky_box_mesh};
+
+    for (SkyMesh *mesh : meshes)
+    {
+        if (mesh->vertex_buffer_object_ != 0)
+            glDeleteBuffers(1, &mesh->vertex_buffer_object_);
+
+        *mesh = SkyMesh();
+    }
+}
+
 // -----------------------------------------------------------------------------
-// Renders a cylindrical 'slice' of the sky between [top] and [bottom] on the z
-// axis
+// Adds a cylindrical 'slice' of the sky between [top] and [bottom] on the z
+// axis to the mesh being built
 // -----------------------------------------------------------------------------
-static void RenderSkySlice(float top, float bottom, float atop, float abottom, float dist, float tx, float ty)
+static void AddSkySlice(float top, float bottom, float atop, float abottom, float dist, float tx, float ty)
 {
     float tc_x  = 0.0f;
     float tc_y1 = (top + 1.0f) * (ty * 0.5f);
@@ -339,44 +446,105 @@ static void RenderSkySlice(float top, float bottom, float atop, float abottom, f
         tc_y2 = -tc_y2;
     }
 
-    glBegin(GL_QUADS);
-
-    // Go through circular points
-    for (unsigned a = 0; a < 31; a++)
+    // Go through circular points, the last one links back to the first
+    for (unsigned a = 0; a < 32; a++)
     {
-        // Top
-        glColor4f(1.0f, 1.0f, 1.0f, atop);
-        glTexCoord2f(tc_x + tx, tc_y1);
-        glVertex3f((sky_circle[a + 1].X * dist), -(sky_circle[a + 1].Y * dist), (top * dist));
-        glTexCoord2f(tc_x, tc_y1);
-        glVertex3f((sky_circle[a].X * dist), -(sky_circle[a].Y * dist), (top * dist));
-
-        // Bottom
-        glColor4f(1.0f, 1.0f, 1.0f, abottom);
-        glTexCoord2f(tc_x, tc_y2);
-        glVertex3f((sky_circle[a].X * dist), -(sky_circle[a].Y * dist), (bottom * dist));
-        glTexCoord2f(tc_x + tx, tc_y2);
-        glVertex3f((sky_circle[a + 1].X * dist), -(sky_circle[a + 1].Y * dist), (bottom * dist));
+        const HMM_Vec2 &p1 = sky_circle[a];
+        const HMM_Vec2 &p2 = sky_circle[(a + 1) % 32];
+
+        float x1 = p1.X * dist, y1 = -(p1.Y * dist);
+        float x2 = p2.X * dist, y2 = -(p2.Y * dist);
+
+        // two triangles per quad: top right, top left, bottom left and
+        // top right, bottom left, bottom right
+        AddSkyVertex(x2, y2, top * dist, tc_x + tx, tc_y1, atop);
+        AddSkyVertex(x1, y1, top * dist, tc_x, tc_y1, atop);
+        AddSkyVertex(x1, y1, bottom * dist, tc_x, tc_y2, abottom);
+
+        AddSkyVertex(x2, y2, top * dist, tc_x + tx, tc_y1, atop);
+        AddSkyVertex(x1, y1, bottom * dist, tc_x, tc_y2, abottom);
+        AddSkyVertex(x2, y2, bottom * dist, tc_x + tx, tc_y2, abottom);
 
         tc_x += tx;
     }
+}
+
+static void BuildSkyCylinderMesh(float dist, float sky_h_ratio, float solid_sky_h)
+{
+    // Check for odd sky sizes
+    float tx = 0.125f;
+    float ty = 2.0f;
+    if (sky_image->ScaledWidthActual() > 256)
+        tx = 0.125f / ((float)sky_image->ScaledWidthActual() / 256.0f);
 
-    // Link last point -> first
-    // Top
-    glColor4f(1.0f, 1.0f, 1.0f, atop);
-    glTexCoord2f(tc_x + tx, tc_y1);
-    glVertex3f((sky_circle[0].X * dist), -(sky_circle[0].Y * dist), (top * dist));
-    glTexCoord2f(tc_x, tc_y1);
-    glVertex3f((sky_circle[31].X * dist), -(sky_circle[31].Y * dist), (top * dist));
-
-    // Bottom
-    glColor4f(1.0f, 1.0f, 1.0f, abottom);
-    glTexCoord2f(tc_x, tc_y2);
-    glVertex3f((sky_circle[31].X * dist), -(sky_circle[31].Y * dist), (bottom * dist));
-    glTexCoord2f(tc_x + tx, tc_y2);
-    glVertex3f((sky_circle[0].X * dist), -(sky_circle[0].Y * dist), (bottom * dist));
+    if (current_sky_stretch == kSkyStretchMirror)
+    {
+        if (sky_image->ScaledHeightActual() > 128)
+        {
+            AddSkySlice(sky_h_ratio, solid_sky_h, 0.0f, 1.0f, dist, tx, ty);   // Top Fade
+            AddSkySlice(solid_sky_h, 0.0f, 1.0f, 1.0f, dist, tx, ty);          // Top Solid
+            AddSkySlice(0.0f, -solid_sky_h, 1.0f, 1.0f, dist, tx, ty);         // Bottom Solid
+            AddSkySlice(-solid_sky_h, -sky_h_ratio, 1.0f, 0.0f, dist, tx, ty); // Bottom Fade
+        }
+        else
+        {
+            AddSkySlice(1.0f, 0.75f, 0.0f, 1.0f, dist, tx, ty);   // Top Fade
+            AddSkySlice(0.75f, 0.0f, 1.0f, 1.0f, dist, tx, ty);   // Top Solid
+            AddSkySlice(0.0f, -0.75f, 1.0f, 1.0f, dist, tx, ty);  // Bottom Solid
+            AddSkySlice(-0.75f, -1.0f, 1.0f, 0.0f, dist, tx, ty); // Bottom Fade
+        }
+    }
+    else if (current_sky_stretch == kSkyStretchRepeat)
+    {
+        if (sky_image->ScaledHeightActual() > 128)
+        {
+            AddSkySlice(sky_h_ratio, solid_sky_h, 0.0f, 1.0f, dist, tx, ty);   // Top Fade
+            AddSkySlice(solid_sky_h, -solid_sky_h, 1.0f, 1.0f, dist, tx, ty);  // Middle Solid
+            AddSkySlice(-solid_sky_h, -sky_h_ratio, 1.0f, 0.0f, dist, tx, ty); // Bottom Fade
+        }
+        else
+        {
+            AddSkySlice(1.0f, 0.75f, 0.0f, 1.0f, dist, tx, ty);   // Top Fade
+            AddSkySlice(0.75f, -0.75f, 1.0f, 1.0f, dist, tx, ty); // Middle Solid
+            AddSkySlice(-0.75f, -1.0f, 1.0f, 0.0f, dist, tx, ty); // Bottom Fade
+        }
+    }
+    else if (current_sky_stretch == kSkyStretchStretch)
+    {
+        if (sky_image->ScaledHeightActual() > 128)
+        {
+            ty = ((float)sky_image->ScaledHeightActual() / 256.0f);
+            AddSkySlice(sky_h_ratio, solid_sky_h, 0.0f, 1.0f, dist, tx, ty);   // Top Fade
+            AddSkySlice(solid_sky_h, -solid_sky_h, 1.0f, 1.0f, dist, tx, ty);  // Middle Solid
+            AddSkySlice(-solid_sky_h, -sky_h_ratio, 1.0f, 0.0f, dist, tx, ty); // Bottom Fade
+        }
+        else
+        {
+            ty = 1.0f;
+            AddSkySlice(1.0f, 0.75f, 0.0f, 1.0f, dist, tx, ty);   // Top Fade
+            AddSkySlice(0.75f, -0.75f, 1.0f, 1.0f, dist, tx, ty); // Middle Solid
+            AddSkySlice(-0.75f, -1.0f, 1.0f, 0.0f, dist, tx, ty); // Bottom Fade
+        }
+    }
+    else // Vanilla (or sane value if somehow this gets set out of expected
+         // range)
+    {
+        if (sky_image->ScaledHeightActual() > 128)
+        {
+            AddSkySlice(sky_h_ratio, solid_sky_h, 0.0f, 1.0f, dist / 2, tx, ty);               // Top Fade
+            AddSkySlice(solid_sky_h, sky_h_ratio - solid_sky_h, 1.0f, 1.0f, dist / 2, tx, ty); // Middle Solid
+            AddSkySlice(sky_h_ratio - solid_sky_h, 0.0f, 1.0f, 0.0f, dist / 2, tx, ty);        // Bottom Fade
+        }
+        else
+        {
+            ty *= 1.5f;
+            AddSkySlice(1.0f, 0.98f, 0.0f, 1.0f, dist / 3, tx, ty);  // Top Fade
+            AddSkySlice(0.98f, 0.35f, 1.0f, 1.0f, dist / 3, tx, ty); // Middle Solid
+            AddSkySlice(0.35f, 0.33f, 1.0f, 0.0f, dist / 3, tx, ty); // Bottom Fade
+        }
+    }
 
-    glEnd();
+    UploadSkyMesh(sky_cylinder_mesh);
 }
 
 static void RenderSkyCylinder(void)
@@ -458,102 +626,25 @@ static void RenderSkyCylinder(void)
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-    // Check for odd sky sizes
-    float tx = 0.125f;
-    float ty = 2.0f;
-    if (sky_image->ScaledWidthActual() > 256)
-        tx = 0.125f / ((float)sky_image->ScaledWidthActual() / 256.0f);
-
     glEnable(GL_ALPHA_TEST);
     glEnable(GL_BLEND);
 
-    if (current_sky_stretch == kSkyStretchMirror)
-    {
-        if (sky_image->ScaledHeightActual() > 128)
-        {
-            RenderSkySlice(sky_h_ratio, solid_sky_h, 0.0f, 1.0f, dist, tx,
-                           ty); // Top Fade
-            RenderSkySlice(solid_sky_h, 0.0f, 1.0f, 1.0f, dist, tx,
-                           ty); // Top Solid
-            RenderSkySlice(0.0f, -solid_sky_h, 1.0f, 1.0f, dist, tx,
-                           ty); // Bottom Solid
-            RenderSkySlice(-solid_sky_h, -sky_h_ratio, 1.0f, 0.0f, dist, tx,
-                           ty); // Bottom Fade
-        }
-        else
-        {
-            RenderSkySlice(1.0f, 0.75f, 0.0f, 1.0f, dist, tx, ty); // Top Fade
-            RenderSkySlice(0.75f, 0.0f, 1.0f, 1.0f, dist, tx, ty); // Top Solid
-            RenderSkySlice(0.0f, -0.75f, 1.0f, 1.0f, dist, tx,
-                           ty);                                    // Bottom Solid
-            RenderSkySlice(-0.75f, -1.0f, 1.0f, 0.0f, dist, tx,
-                           ty);                                    // Bottom Fade
-        }
-    }
-    else if (current_sky_stretch == kSkyStretchRepeat)
-    {
-        if (sky_image->ScaledHeightActual() > 128)
-        {
-            RenderSkySlice(sky_h_ratio, solid_sky_h, 0.0f, 1.0f, dist, tx,
-                           ty); // Top Fade
-            RenderSkySlice(solid_sky_h, -solid_sky_h, 1.0f, 1.0f, dist, tx,
-                           ty); // Middle Solid
-            RenderSkySlice(-solid_sky_h, -sky_h_ratio, 1.0f, 0.0f, dist, tx,
-                           ty); // Bottom Fade
-        }
-        else
-        {
-            RenderSkySlice(1.0f, 0.75f, 0.0f, 1.0f, dist, tx, ty); // Top Fade
-            RenderSkySlice(0.75f, -0.75f, 1.0f, 1.0f, dist, tx,
-                           ty);                                    // Middle Solid
-            RenderSkySlice(-0.75f, -1.0f, 1.0f, 0.0f, dist, tx,
-                           ty);                                    // Bottom Fade
-        }
-    }
-    else if (current_sky_stretch == kSkyStretchStretch)
-    {
-        if (sky_image->ScaledHeightActual() > 128)
-        {
-            ty = ((float)sky_image->ScaledHeightActual() / 256.0f);
-            RenderSkySlice(sky_h_ratio, solid_sky_h, 0.0f, 1.0f, dist, tx,
-                           ty); // Top Fade
-            RenderSkySlice(solid_sky_h, -solid_sky_h, 1.0f, 1.0f, dist, tx,
-                           ty); // Middle Solid
-            RenderSkySlice(-solid_sky_h, -sky_h_ratio, 1.0f, 0.0f, dist, tx,
-                           ty); // Bottom Fade
-        }
-        else
-        {
-            ty = 1.0f;
-            RenderSkySlice(1.0f, 0.75f, 0.0f, 1.0f, dist, tx, ty); // Top Fade
-            RenderSkySlice(0.75f, -0.75f, 1.0f, 1.0f, dist, tx,
-                           ty);                                    // Middle Solid
-            RenderSkySlice(-0.75f, -1.0f, 1.0f, 0.0f, dist, tx,
-                           ty);                                    // Bottom Fade
-        }
-    }
-    else // Vanilla (or sane value if somehow this gets set out of expected
-         // range)
+    SkyMesh &mesh = sky_cylinder_mesh;
+
+    if (mesh.vertex_buffer_object_ == 0 || mesh.image_ != sky_image || mesh.stretch_ != current_sky_stretch ||
+        mesh.dist_ != dist)
     {
-        if (sky_image->ScaledHeightActual() > 128)
-        {
-            RenderSkySlice(sky_h_ratio, solid_sky_h, 0.0f, 1.0f, dist / 2, tx,
-                           ty);                                                                   // Top Fade
-            RenderSkySlice(solid_sky_h, sky_h_ratio - solid_sky_h, 1.0f, 1.0f, dist / 2, tx, ty); // Middle Solid
-            RenderSkySlice(sky_h_ratio - solid_sky_h, 0.0f, 1.0f, 0.0f, dist / 2, tx, ty);        // Bottom Fade
-        }
-        else
-        {
-            ty *= 1.5f;
-            RenderSkySlice(1.0f, 0.98f, 0.0f, 1.0f, dist / 3, tx,
-                           ty); // Top Fade
-            RenderSkySlice(0.98f, 0.35f, 1.0f, 1.0f, dist / 3, tx,
-                           ty); // Middle Solid
-            RenderSkySlice(0.35f, 0.33f, 1.0f, 0.0f, dist / 3, tx,
-                           ty); // Bottom Fade
-        }
+        BuildSkyCylinderMesh(dist, sky_h_ratio, solid_sky_h);
+
+        mesh.image_   = sky_image;
+        mesh.stretch_ = current_sky_stretch;
+        mesh.dist_    = dist;
     }
 
+    BindSkyMesh(mesh, true);
+    glDrawArrays(GL_TRIANGLES, 0, mesh.total_vertices_);
+    UnbindSkyMesh();
+
     glDisable(GL_BLEND);
     glDisable(GL_ALPHA_TEST);
     if (!draw_culling.d_)
@@ -562,6 +653,48 @@ static void RenderSkyCylinder(void)
     RendererRevertSkyMatrices();
 }
 
+class SkyboxFaceCorners
+{
+  public:
+    int face;
+
+    float normal[3];
+
+    // corners in units of the box size, with texture coordinates
+    // (v0,v0) (v0,v1) (v1,v1) (v1,v0)
+    float corner[4][3];
+};
+
+static const SkyboxFaceCorners skybox_faces[6] = {
+    {kSkyboxTop, {0, 0, -1}, {{-1, 1, 1}, {-1, -1, 1}, {1, -1, 1}, {1, 1, 1}}},
+    {kSkyboxBottom, {0, 0, 1}, {{-1, -1, -1}, {-1, 1, -1}, {1, 1, -1}, {1, -1, -1}}},
+    {kSkyboxNorth, {0, -1, 0}, {{-1, 1, -1}, {-1, 1, 1}, {1, 1, 1}, {1, 1, -1}}},
+    {kSkyboxEast, {-1, 0, 0}, {{1, 1, -1}, {1, 1, 1}, {1, -1, 1}, {1, -1, -1}}},
+    {kSkyboxSouth, {0, 1, 0}, {{1, -1, -1}, {1, -1, 1}, {-1, -1, 1}, {-1, -1, -1}}},
+    {kSkyboxWest, {1, 0, 0}, {{-1, -1, -1}, {-1, -1, 1}, {-1, 1, 1}, {-1, 1, -1}}}};
+
+static void BuildSkyboxMesh(float dist, float v0, float v1)
+{
+    const float tex_u[4] = {v0, v0, v1, v1};
+    const float tex_v[4] = {v0, v1, v1, v0};
+
+    // each face is two triangles, corners 0 1 2 and 0 2 3
+    static const int order[6] = {0, 1, 2, 0, 2, 3};
+
+    for (const SkyboxFaceCorners &f : skybox_faces)
+    {
+        for (int k : order)
+        {
+            AddSkyVertex(f.corner[k][0] * dist, f.corner[k][1] * dist, f.corner[k][2] * dist, tex_u[k], tex_v[k],
+                         1.0f);
+
+            sky_mesh_vertices.back().normal = {{f.normal[0], f.normal[1], f.normal[2]}};
+        }
+    }
+
+    UploadSkyMesh(sky_box_mesh);
+}
+
 static void RenderSkybox(void)
 {
     float dist = renderer_far_clip.f_ / 2.0f;
@@ -613,113 +746,29 @@ static void RenderSkybox(void)
         glEnable(GL_FOG);
     }
 
-    // top
-    glBindTexture(GL_TEXTURE_2D, fake_box[SK].texture[kSkyboxTop]);
-    glNormal3i(0, 0, -1);
-#ifdef APPLE_SILICON
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-#endif
-    glBegin(GL_QUADS);
-    glTexCoord2f(v0, v0);
-    glVertex3f(-dist, dist, +dist);
-    glTexCoord2f(v0, v1);
-    glVertex3f(-dist, -dist, +dist);
-    glTexCoord2f(v1, v1);
-    glVertex3f(dist, -dist, +dist);
-    glTexCoord2f(v1, v0);
-    glVertex3f(dist, dist, +dist);
-    glEnd();
+    SkyMesh &mesh = sky_box_mesh;
 
-    // bottom
-    glBindTexture(GL_TEXTURE_2D, fake_box[SK].texture[kSkyboxBottom]);
-    glNormal3i(0, 0, +1);
-#ifdef APPLE_SILICON
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-#endif
-    glBegin(GL_QUADS);
-    glTexCoord2f(v0, v0);
-    glVertex3f(-dist, -dist, -dist);
-    glTexCoord2f(v0, v1);
-    glVertex3f(-dist, dist, -dist);
-    glTexCoord2f(v1, v1);
-    glVertex3f(dist, dist, -dist);
-    glTexCoord2f(v1, v0);
-    glVertex3f(dist, -dist, -dist);
-    glEnd();
+    if (mesh.vertex_buffer_object_ == 0 || mesh.dist_ != dist || mesh.v0_ != v0)
+    {
+        BuildSkyboxMesh(dist, v0, v1);
 
-    // north
-    glBindTexture(GL_TEXTURE_2D, fake_box[SK].texture[kSkyboxNorth]);
-    glNormal3i(0, -1, 0);
-#ifdef APPLE_SILICON
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-#endif
-    glBegin(GL_QUADS);
-    glTexCoord2f(v0, v0);
-    glVertex3f(-dist, dist, -dist);
-    glTexCoord2f(v0, v1);
-    glVertex3f(-dist, dist, +dist);
-    glTexCoord2f(v1, v1);
-    glVertex3f(dist, dist, +dist);
-    glTexCoord2f(v1, v0);
-    glVertex3f(dist, dist, -dist);
-    glEnd();
+        mesh.dist_ = dist;
+        mesh.v0_   = v0;
+    }
 
-    // east
-    glBindTexture(GL_TEXTURE_2D, fake_box[SK].texture[kSkyboxEast]);
-    glNormal3i(-1, 0, 0);
-#ifdef APPLE_SILICON
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-#endif
-    glBegin(GL_QUADS);
-    glTexCoord2f(v0, v0);
-    glVertex3f(dist, dist, -dist);
-    glTexCoord2f(v0, v1);
-    glVertex3f(dist, dist, +dist);
-    glTexCoord2f(v1, v1);
-    glVertex3f(dist, -dist, +dist);
-    glTexCoord2f(v1, v0);
-    glVertex3f(dist, -dist, -dist);
-    glEnd();
+    BindSkyMesh(mesh, false);
 
-    // south
-    glBindTexture(GL_TEXTURE_2D, fake_box[SK].texture[kSkyboxSouth]);
-    glNormal3i(0, +1, 0);
+    for (int i = 0; i < 6; i++)
+    {
+        glBindTexture(GL_TEXTURE_2D, fake_box[SK].texture[skybox_faces[i].face]);
 #ifdef APPLE_SILICON
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
 #endif
-    glBegin(GL_QUADS);
-    glTexCoord2f(v0, v0);
-    glVertex3f(dist, -dist, -dist);
-    glTexCoord2f(v0, v1);
-    glVertex3f(dist, -dist, +dist);
-    glTexCoord2f(v1, v1);
-    glVertex3f(-dist, -dist, +dist);
-    glTexCoord2f(v1, v0);
-    glVertex3f(-dist, -dist, -dist);
-    glEnd();
+        glDrawArrays(GL_TRIANGLES, i * 6, 6);
+    }
 
-    // west
-    glBindTexture(GL_TEXTURE_2D, fake_box[SK].texture[kSkyboxWest]);
-    glNormal3i(+1, 0, 0);
-#ifdef APPLE_SILICON
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-#endif
-    glBegin(GL_QUADS);
-    glTexCoord2f(v0, v0);
-    glVertex3f(-dist, -dist, -dist);
-    glTexCoord2f(v0, v1);
-    glVertex3f(-dist, -dist, +dist);
-    glTexCoord2f(v1, v1);
-    glVertex3f(-dist, dist, +dist);
-    glTexCoord2f(v1, v0);
-    glVertex3f(-dist, dist, -dist);
-    glEnd();
+    UnbindSkyMesh();
 
     glDisable(GL_TEXTURE_2D);
     if (!draw_culling.d_)
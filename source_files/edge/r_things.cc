@@ -767,11 +767,9 @@ static void RendererClipSpriteVertically(DrawSubsector *dsub, DrawThing *dthing)
 
     float z = (dthing->top + dthing->bottom) / 2.0f;
 
-    std::vector<DrawFloor *>::iterator DFI;
-
-    for (DFI = dsub->floors.begin(); DFI != dsub->floors.end(); DFI++)
+    for (DrawFloor *df : dsub->floors)
     {
-        dfloor = *DFI;
+        dfloor = df;
 
         if (z <= dfloor->top_height)
             break;
@@ -999,7 +997,7 @@ void RendererWalkThing(DrawSubsector *dsub, MapObject *mo)
     dthing->map_y      = my;
     dthing->map_z      = mz;
 
-    dthing->properties = dsub->floors[0]->properties;
+    dthing->properties = dsub->floors.First()->properties;
     dthing->y_clipping = y_clipping;
     dthing->is_model   = is_model;
 
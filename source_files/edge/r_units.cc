@@ -28,6 +28,7 @@
 #include "AlmostEquals.h"
 #include "dm_state.h"
 #include "e_player.h"
+#include "e_profile.h"
 #include "edge_profiling.h"
 #include "epi.h"
 #include "i_defs_gl.h"
@@ -94,6 +95,40 @@ static bool batch_sort;
 
 sg_color culling_fog_color;
 
+// a private, growable set of units built by one thread.  The vertex
+// colors have already been adjusted by EndRenderUnit().
+class UnitRecording
+{
+  public:
+    std::vector<RendererVertex> verts_;
+    std::vector<RendererUnit>   units_;
+
+    ECFrameStats stats_;
+
+    bool hazard_;
+
+  public:
+    UnitRecording() : verts_(), units_(), hazard_(false)
+    {
+        stats_.Clear();
+    }
+
+    ~UnitRecording()
+    {
+    }
+
+    void Clear()
+    {
+        verts_.clear();
+        units_.clear();
+        stats_.Clear();
+
+        hazard_ = false;
+    }
+};
+
+static thread_local UnitRecording *current_recording = nullptr;
+
 //
 // StartUnitBatch
 //
@@ -142,19 +177,30 @@ RendererVertex *BeginRenderUnit(GLuint shape, int max_vert, GLuint env1, GLuint
 
     EPI_ASSERT((blending & (kBlendingCullBack | kBlendingCullFront)) != (kBlendingCullBack | kBlendingCullFront));
 
-    // check we have enough space left
-    if (current_render_vert + max_vert > kMaximumLocalVertices || current_render_unit >= kMaximumLocalUnits)
-    {
-        RenderCurrentUnits();
-    }
-
-    unit = local_units + current_render_unit;
-
     if (env1 == kTextureEnvironmentDisable)
         tex1 = 0;
     if (env2 == kTextureEnvironmentDisable)
         tex2 = 0;
 
+    if (current_recording)
+    {
+        UnitRecording *rec = current_recording;
+
+        rec->units_.push_back(RendererUnit());
+
+        unit = &rec->units_.back();
+    }
+    else
+    {
+        // check we have enough space left
+        if (current_render_vert + max_vert > kMaximumLocalVertices || current_render_unit >= kMaximumLocalUnits)
+        {
+            RenderCurrentUnits();
+        }
+
+        unit = local_units + current_render_unit;
+    }
+
     unit->shape               = shape;
     unit->environment_mode[0] = env1;
     unit->environment_mode[1] = env2;
@@ -168,6 +214,17 @@ RendererVertex *BeginRenderUnit(GLuint shape, int max_vert, GLuint env1, GLuint
     unit->fog_color   = fog_color;
     unit->fog_density = fog_density;
 
+    if (current_recording)
+    {
+        UnitRecording *rec = current_recording;
+
+        unit->first = (int)rec->verts_.size();
+
+        rec->verts_.resize(unit->first + max_vert);
+
+        return rec->verts_.data() + unit->first;
+    }
+
     return local_verts + current_render_vert;
 }
 
@@ -180,6 +237,27 @@ void EndRenderUnit(int actual_vert)
 
     EPI_ASSERT(actual_vert > 0);
 
+    if (current_recording)
+    {
+        UnitRecording *rec = current_recording;
+
+        unit = &rec->units_.back();
+
+        unit->count = actual_vert;
+
+        rec->verts_.resize(unit->first + actual_vert);
+
+        for (int i = 0; i < actual_vert; i++)
+        {
+            RendererVertex *v = &rec->verts_[unit->first + i];
+
+            v->rgba_color[0] *= render_view_red_multiplier;
+            v->rgba_color[1] *= render_view_green_multiplier;
+            v->rgba_color[2] *= render_view_blue_multiplier;
+        }
+        return;
+    }
+
     unit = local_units + current_render_unit;
 
     unit->count = actual_vert;
@@ -201,6 +279,127 @@ void EndRenderUnit(int actual_vert)
     EPI_ASSERT(current_render_unit <= kMaximumLocalUnits);
 }
 
+//
+// Unit recording
+//
+
+UnitRecording *CreateUnitRecording(void)
+{
+    return new UnitRecording();
+}
+
+void DestroyUnitRecording(UnitRecording *rec)
+{
+    EPI_ASSERT(rec != current_recording);
+
+    delete rec;
+}
+
+void StartUnitRecording(UnitRecording *rec)
+{
+    EPI_ASSERT(rec);
+    EPI_ASSERT(!current_recording);
+
+    rec->Clear();
+
+    current_recording = rec;
+}
+
+void StopUnitRecording(void)
+{
+    current_recording = nullptr;
+}
+
+bool UnitRecordingActive(void)
+{
+    return current_recording != nullptr;
+}
+
+int UnitRecordingMark(void)
+{
+    EPI_ASSERT(current_recording);
+
+    return (int)current_recording->units_.size();
+}
+
+void UnitRecordingRewind(int mark)
+{
+    UnitRecording *rec = current_recording;
+
+    EPI_ASSERT(rec);
+    EPI_ASSERT(mark >= 0 && mark <= (int)rec->units_.size());
+
+    if (mark < (int)rec->units_.size())
+    {
+        rec->verts_.resize(rec->units_[mark].first);
+        rec->units_.resize(mark);
+    }
+
+    rec->hazard_ = false;
+}
+
+bool UnitRecordingHazard(void)
+{
+    if (!current_recording)
+        return false;
+
+    current_recording->hazard_ = true;
+    return true;
+}
+
+bool UnitRecordingSpoiled(void)
+{
+    return current_recording && current_recording->hazard_;
+}
+
+ECFrameStats &UnitFrameStats(void)
+{
+    if (current_recording)
+        return current_recording->stats_;
+
+    return ec_frame_stats;
+}
+
+void ReplayUnitRecording(UnitRecording *rec, int first, int last)
+{
+    EPI_ASSERT(!current_recording);
+    EPI_ASSERT(first >= 0 && last <= (int)rec->units_.size());
+
+    for (int i = first; i < last; i++)
+    {
+        const RendererUnit *src = &rec->units_[i];
+
+        if (current_render_vert + src->count > kMaximumLocalVertices || current_render_unit >= kMaximumLocalUnits)
+        {
+            RenderCurrentUnits();
+        }
+
+        RendererUnit *unit = local_units + current_render_unit;
+
+        *unit       = *src;
+        unit->first = current_render_vert;
+
+        memcpy(local_verts + current_render_vert, rec->verts_.data() + src->first,
+               src->count * sizeof(RendererVertex));
+
+        current_render_vert += src->count;
+        current_render_unit++;
+    }
+}
+
+void MergeUnitRecordingStats(UnitRecording *rec)
+{
+    EPI_ASSERT(!current_recording);
+
+    ec_frame_stats.draw_wall_parts += rec->stats_.draw_wall_parts;
+    ec_frame_stats.draw_planes += rec->stats_.draw_planes;
+    ec_frame_stats.draw_things += rec->stats_.draw_things;
+    ec_frame_stats.draw_light_iterator += rec->stats_.draw_light_iterator;
+    ec_frame_stats.draw_sector_glow_iterator += rec->stats_.draw_sector_glow_iterator;
+
+    rec->stats_.Clear();
+}
+
 struct Compare_Unit_pred
 {
     inline bool operator()(const RendererUnit *A, const RendererUnit *B) const
@@ -271,6 +470,7 @@ static inline void RendererSendRawVector(const RendererVertex *V)
 void RenderCurrentUnits(void)
 {
     EDGE_ZoneScoped;
+    EDGE_ProfileScope(kProfileTimerRenderUnits);
 
     if (current_render_unit == 0)
         return;
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "HandmadeMath.h"
+#include "edge_profiling.h"
 #include "epi_color.h"
 #include "i_defs_gl.h"
 #include "sokol_color.h"
@@ -78,5 +79,40 @@ RendererVertex *BeginRenderUnit(GLuint shape, int max_vert, GLuint env1, GLuint
                                 int pass, int blending, RGBAColor fog_color = kRGBANoValue, float fog_density = 0);
 void            EndRenderUnit(int actual_vert);
 
+// Unit recording: lets worker threads build units into a private
+// buffer instead of the shared batch.  The main thread then replays
+// them, in their original order, into the current batch.
+class UnitRecording;
+
+UnitRecording *CreateUnitRecording(void);
+void           DestroyUnitRecording(UnitRecording *rec);
+
+// units begun on the calling thread go into `rec' (which is emptied
+// first) until StopUnitRecording() is called.
+void StartUnitRecording(UnitRecording *rec);
+void StopUnitRecording(void);
+bool UnitRecordingActive(void);
+
+// the number of units recorded so far on the calling thread, and a
+// way to discard everything recorded after such a mark.  Rewinding
+// also forgets any hazard.
+int  UnitRecordingMark(void);
+void UnitRecordingRewind(int mark);
+
+// Called by code which may only run on the main thread (texture
+// uploads, changes to level data, etc).  When the calling thread is
+// recording, this flags the recording as spoiled and returns true,
+// and the caller must skip the operation.  Otherwise returns false.
+bool UnitRecordingHazard(void);
+bool UnitRecordingSpoiled(void);
+
+// frame statistics for the calling thread: the recording's own
+// counters while recording, otherwise the global ones.
+ECFrameStats &UnitFrameStats(void);
+
+// main thread only.
+void ReplayUnitRecording(UnitRecording *rec, int first, int last);
+void MergeUnitRecordingStats(UnitRecording *rec);
+
 //--- editor settings ---
 // vi:ts=4:sw=4:noexpandtab
@@ -698,6 +698,10 @@ struct RADScript
 
     // CRC of the important parts of this RTS script.
     epi::CRC32 crc;
+
+    // radius check can only pass near a player, see ScriptMarkNearPlayers
+    bool spatial_index = false;
+    int  near_stamp    = 0;
 };
 
 // Dynamic Trigger info.
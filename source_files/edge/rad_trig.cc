@@ -34,11 +34,16 @@
 
 #include "rad_trig.h"
 
+#include <unordered_map>
+#include <vector>
+
+#include "HandmadeMath.h"
 #include "am_map.h"
 #include "dm_defs.h"
 #include "dm_state.h"
 #include "e_input.h"
 #include "e_main.h"
+#include "e_profile.h"
 #include "epi.h"
 #include "epi_file.h"
 #include "epi_filesystem.h"
@@ -468,6 +473,211 @@ bool ScriptRadiusCheck(MapObject *mo, RADScript *r)
     return true;
 }
 
+//
+// Spatial index of the radius triggers.
+//
+// A trigger whose area is a box, a sector tag or a sector can only
+// pass ScriptRadiusCheck() for a player standing in it, so each tic
+// the scripts near some player are stamped and the rest are skipped
+// without testing.  The stamps are redone after any RTS action runs,
+// since actions can move players around.
+//
+
+static constexpr float kScriptGridCellSize = 256.0f;
+static constexpr int   kScriptGridMaxCells = 65536;
+
+static bool rts_index_dirty = true;
+
+static std::unordered_map<int, std::vector<RADScript *>> rts_tag_index;
+static std::unordered_map<int, std::vector<RADScript *>> rts_sector_index;
+
+static std::vector<std::vector<RADScript *>> rts_grid;
+
+static float rts_grid_x;
+static float rts_grid_y;
+static float rts_grid_cell;
+static int   rts_grid_width;
+static int   rts_grid_height;
+
+static int  rts_near_stamp = 0;
+static bool rts_near_valid = false;
+
+static void ScriptGridRange(float x1, float y1, float x2, float y2, int *cx1, int *cy1, int *cx2, int *cy2)
+{
+    *cx1 = HMM_MAX(0, (int)floorf((x1 - rts_grid_x) / rts_grid_cell));
+    *cy1 = HMM_MAX(0, (int)floorf((y1 - rts_grid_y) / rts_grid_cell));
+    *cx2 = HMM_MIN(rts_grid_width - 1, (int)floorf((x2 - rts_grid_x) / rts_grid_cell));
+    *cy2 = HMM_MIN(rts_grid_height - 1, (int)floorf((y2 - rts_grid_y) / rts_grid_cell));
+}
+
+static void ScriptBuildSpatialIndex(void)
+{
+    rts_tag_index.clear();
+    rts_sector_index.clear();
+    rts_grid.clear();
+
+    rts_grid_width = rts_grid_height = 0;
+
+    std::vector<RADScript *> boxes;
+
+    float min_x = 0, min_y = 0, max_x = 0, max_y = 0;
+
+    // a script with two triggers (possible after loading a game) simply
+    // goes in a list twice.
+    for (RADScriptTrigger *trig = active_triggers; trig; trig = trig->next)
+    {
+        RADScript *r = trig->info;
+
+        r->spatial_index = true;
+
+        // same order of tests as ScriptRadiusCheck()
+        if (r->sector_tag > 0)
+            rts_tag_index[r->sector_tag].push_back(r);
+        else if (r->sector_index >= 0 && r->sector_index <= total_level_sectors)
+            rts_sector_index[r->sector_index].push_back(r);
+        else if (r->rad_x >= 0 && r->rad_y >= 0)
+        {
+            if (boxes.empty())
+            {
+                min_x = r->x - r->rad_x;
+                min_y = r->y - r->rad_y;
+                max_x = r->x + r->rad_x;
+                max_y = r->y + r->rad_y;
+            }
+            else
+            {
+                min_x = HMM_MIN(min_x, r->x - r->rad_x);
+                min_y = HMM_MIN(min_y, r->y - r->rad_y);
+                max_x = HMM_MAX(max_x, r->x + r->rad_x);
+                max_y = HMM_MAX(max_y, r->y + r->rad_y);
+            }
+
+            boxes.push_back(r);
+        }
+        else
+        {
+            // covers the whole map along one axis
+            r->spatial_index = false;
+        }
+    }
+
+    if (!boxes.empty())
+    {
+        rts_grid_x    = min_x;
+        rts_grid_y    = min_y;
+        rts_grid_cell = kScriptGridCellSize;
+
+        for (;;)
+        {
+            rts_grid_width  = (int)((max_x - min_x) / rts_grid_cell) + 1;
+            rts_grid_height = (int)((max_y - min_y) / rts_grid_cell) + 1;
+
+            if ((int64_t)rts_grid_width * rts_grid_height <= kScriptGridMaxCells)
+                break;
+
+            rts_grid_cell *= 2;
+        }
+
+        rts_grid.resize(rts_grid_width * rts_grid_height);
+
+        for (RADScript *r : boxes)
+        {
+            int cx1, cy1, cx2, cy2;
+
+            ScriptGridRange(r->x - r->rad_x, r->y - r->rad_y, r->x + r->rad_x, r->y + r->rad_y, &cx1, &cy1, &cx2,
+                            &cy2);
+
+            for (int cy = cy1; cy <= cy2; cy++)
+                for (int cx = cx1; cx <= cx2; cx++)
+                    rts_grid[cy * rts_grid_width + cx].push_back(r);
+        }
+    }
+
+    rts_index_dirty = false;
+    rts_near_valid  = false;
+}
+
+static void ScriptMarkList(const std::unordered_map<int, std::vector<RADScript *>> &index, int key)
+{
+    auto find = index.find(key);
+
+    if (find == index.end())
+        return;
+
+    for (RADScript *r : find->second)
+        r->near_stamp = rts_near_stamp;
+}
+
+static void ScriptMarkNearPlayers(void)
+{
+    if (rts_index_dirty)
+        ScriptBuildSpatialIndex();
+
+    rts_near_stamp++;
+    rts_near_valid = true;
+
+    for (int pnum = 0; pnum < kMaximumPlayers; pnum++)
+    {
+        Player *p = players[pnum];
+
+        if (!p || !p->map_object_)
+            continue;
+
+        MapObject *mo     = p->map_object_;
+        Sector    *sector = mo->subsector_->sector;
+
+        if (sector->tag > 0)
+            ScriptMarkList(rts_tag_index, sector->tag);
+
+        ScriptMarkList(rts_sector_index, (int)(sector - level_sectors));
+
+        if (rts_grid.empty())
+            continue;
+
+        int cx1, cy1, cx2, cy2;
+
+        ScriptGridRange(mo->x - mo->radius_, mo->y - mo->radius_, mo->x + mo->radius_, mo->y + mo->radius_, &cx1,
+                        &cy1, &cx2, &cy2);
+
+        for (int cy = cy1; cy <= cy2; cy++)
+            for (int cx = cx1; cx <= cx2; cx++)
+                for (RADScript *r : rts_grid[cy * rts_grid_width + cx])
+                    r->near_stamp = rts_near_stamp;
+    }
+}
+
+//
+// Live monster counts for the ONDEATH conditions, made with one pass
+// over the map objects and kept until something could have changed
+// them (the next tic, or any RTS action).
+//
+
+static std::unordered_map<const MapObjectDefinition *, int> rts_live_monsters;
+static bool                                                 rts_live_monsters_valid = false;
+
+static int ScriptCountLiveMonsters(const MapObjectDefinition *info)
+{
+    if (!rts_live_monsters_valid)
+    {
+        rts_live_monsters.clear();
+
+        for (MapObject *mo = map_object_list_head; mo != nullptr; mo = mo->next_)
+        {
+            if (mo->health_ > 0)
+                rts_live_monsters[mo->info_]++;
+        }
+
+        rts_live_monsters_valid = true;
+    }
+
+    auto find = rts_live_monsters.find(info);
+
+    if (find == rts_live_monsters.end())
+        return 0;
+
+    return find->second;
+}
+
 static int ScriptAlivePlayers(void)
 {
     int result = 0;
@@ -485,6 +695,15 @@ static int ScriptAlivePlayers(void)
 
 static int ScriptAllPlayersInRadius(RADScript *r, int mask)
 {
+    if (r->spatial_index)
+    {
+        if (!rts_near_valid)
+            ScriptMarkNearPlayers();
+
+        if (r->near_stamp != rts_near_stamp)
+            return 0;
+    }
+
     int result = 0;
 
     for (int pnum = 0; pnum < kMaximumPlayers; pnum++)
@@ -530,10 +749,6 @@ static int ScriptAllPlayersCheckCondition(RADScript *r, int mask)
 
 static bool ScriptCheckBossTrigger(RADScriptTrigger *trig, ScriptOnDeathParameter *cond)
 {
-    MapObject *mo;
-
-    int count = 0;
-
     // lookup thing type if we haven't already done so
     if (!cond->cached_info)
     {
@@ -548,22 +763,14 @@ static bool ScriptCheckBossTrigger(RADScriptTrigger *trig, ScriptOnDeathParamete
         }
     }
 
-    // scan the remaining mobjs to see if all bosses are dead
-    for (mo = map_object_list_head; mo != nullptr; mo = mo->next_)
-    {
-        if (seen_monsters.count(cond->cached_info) == 0)
-            return false; // Never on map?
-
-        if (mo->info_ == cond->cached_info && mo->health_ > 0)
-        {
-            count++;
+    // see if all bosses are dead
+    if (map_object_list_head == nullptr)
+        return true;
 
-            if (count > cond->threshhold)
-                return false;
-        }
-    }
+    if (seen_monsters.count(cond->cached_info) == 0)
+        return false; // Never on map?
 
-    return true;
+    return ScriptCountLiveMonsters(cond->cached_info) <= cond->threshhold;
 }
 
 static bool ScriptCheckHeightTrigger(RADScriptTrigger *trig, ScriptOnHeightParameter *cond)
@@ -678,8 +885,14 @@ static void DoRemoveTrigger(RADScriptTrigger *trig)
 //
 void RunScriptTriggers(void)
 {
+    EDGE_ProfileScope(kProfileTimerRTS);
+
     RADScriptTrigger *trig, *next;
 
+    // the thinkers have run since the last tic
+    rts_near_valid          = false;
+    rts_live_monsters_valid = false;
+
     // Start looking through the trigger list.
     for (trig = active_triggers; trig; trig = next)
     {
@@ -792,6 +1005,10 @@ void RunScriptTriggers(void)
 
             (*state->action)(trig, state->param);
 
+            // the action may have moved players or killed monsters
+            rts_near_valid          = false;
+            rts_live_monsters_valid = false;
+
             if (!trig->state)
                 break;
 
@@ -828,13 +1045,21 @@ void ScriptUpdateMonsterDeaths(MapObject *mo)
     {
         mo->hyper_flags_ &= ~kHyperFlagWaitUntilDead;
 
+        std::vector<int> tags;
+
+        for (auto tag : epi::SeparatedStringVector(mo->wait_until_dead_tags_, ','))
+            tags.push_back(atoi(tag.c_str()));
+
         RADScriptTrigger *trig;
 
         for (trig = active_triggers; trig; trig = trig->next)
         {
-            for (auto tag : epi::SeparatedStringVector(mo->wait_until_dead_tags_, ','))
+            if (trig->wud_tag == 0)
+                continue;
+
+            for (int tag : tags)
             {
-                if (trig->wud_tag == atoi(tag.c_str()))
+                if (trig->wud_tag == tag)
                     trig->wud_count--;
             }
         }
@@ -932,6 +1157,8 @@ void SpawnScriptTriggers(const char *map_name)
 
         active_triggers = trig;
     }
+
+    rts_index_dirty = true;
 }
 
 static void ScriptClearCachedInfo(void)
@@ -969,6 +1196,11 @@ void ClearScriptTriggers(void)
 
     ScriptClearCachedInfo();
     ResetScriptTips();
+
+    // loading a game fills in the new triggers after this
+    rts_index_dirty         = true;
+    rts_near_valid          = false;
+    rts_live_monsters_valid = false;
 }
 
 void InitializeRADScripts(void)
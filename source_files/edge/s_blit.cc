@@ -28,6 +28,7 @@
 #include <list>
 
 #include "dm_state.h"
+#include "e_profile.h"
 #include "epi.h"
 #include "epi_sdl.h"
 #include "i_system.h"
@@ -466,6 +467,8 @@ void MixAllSoundChannels(void *stream, int len)
     if (no_sound || len <= 0)
         return;
 
+    EDGE_ProfileScope(kProfileTimerSoundMixing);
+
     int pairs = len / sound_device_bytes_per_sample;
 
     int samples = pairs;
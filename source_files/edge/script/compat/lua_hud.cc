@@ -3,6 +3,7 @@
 #include "ddf_font.h"
 #include "dm_state.h"
 #include "e_player.h"
+#include "e_profile.h"
 #include "g_game.h"
 #include "hu_draw.h"
 #include "i_system.h"
@@ -1031,6 +1032,8 @@ void LuaRegisterHUDLibrary(lua_State *L)
 
 void LuaRunHUD(void)
 {
+    EDGE_ProfileScope(kProfileTimerLuaHUD);
+
     HUDReset();
 
     ui_hud_who    = players[display_player];
@@ -216,8 +216,7 @@ bool SaveFileVerifyContents(void)
         }
 
         // skip data bytes (merely compute the CRC)
-        for (; (file_len > 0) && !last_error; file_len--)
-            SaveChunkGetByte();
+        SaveChunkSkipBytes(file_len);
 
         // run out of data ?
         if (last_error)
@@ -317,6 +316,122 @@ uint8_t SaveChunkGetByte(void)
     return result;
 }
 
+//
+// Returns a pointer to the next `count' bytes of the current chunk and
+// moves past them.  Only valid when a chunk is on the stack.
+//
+static const uint8_t *ReadChunkSpan(int count)
+{
+    SaveChunk *cur = &chunk_stack[chunk_stack_size - 1];
+
+    EPI_ASSERT(cur->start);
+    EPI_ASSERT(cur->position >= cur->start);
+    EPI_ASSERT(cur->position <= cur->end);
+
+    if (count > cur->end - cur->position)
+    {
+        FatalError("LOADGAME: Corrupt Savegame (reached end of [%s] chunk).\n", cur->start_marker);
+        last_error = 2;
+        return nullptr;
+    }
+
+    const uint8_t *result = cur->position;
+    cur->position += count;
+
+    return result;
+}
+
+void SaveChunkGetBytes(uint8_t *dest, int count)
+{
+    if (last_error || count <= 0)
+        return;
+
+    // read directly from file when no chunks are on the stack
+    if (chunk_stack_size == 0)
+    {
+        if (fread(dest, 1, count, current_file_pointer) != (size_t)count)
+        {
+            FatalError("LOADGAME: Corrupt Savegame (reached EOF).\n");
+            last_error = 1;
+            return;
+        }
+
+        current_crc.AddBlock(dest, count);
+        return;
+    }
+
+    const uint8_t *src = ReadChunkSpan(count);
+
+    if (src)
+        memcpy(dest, src, count);
+}
+
+void SaveChunkSkipBytes(int count)
+{
+    if (last_error || count <= 0)
+        return;
+
+    if (chunk_stack_size == 0)
+    {
+        uint8_t buffer[1024];
+
+        for (; count > 0 && !last_error; count -= 1024)
+            SaveChunkGetBytes(buffer, HMM_MIN(count, 1024));
+
+        return;
+    }
+
+    ReadChunkSpan(count);
+}
+
+void SaveChunkGetIntegerArray(uint32_t *dest, int count)
+{
+    if (last_error || count <= 0)
+        return;
+
+    if (chunk_stack_size == 0)
+    {
+        for (int i = 0; i < count; i++)
+            dest[i] = SaveChunkGetInteger();
+        return;
+    }
+
+    const uint8_t *src = ReadChunkSpan(count * 4);
+
+    if (!src)
+        return;
+
+    for (int i = 0; i < count; i++, src += 4)
+        dest[i] = src[0] | (src[1] << 8) | (src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+void SaveChunkGetFloatArray(float *dest, int count)
+{
+    if (last_error || count <= 0)
+        return;
+
+    if (chunk_stack_size == 0)
+    {
+        for (int i = 0; i < count; i++)
+            dest[i] = SaveChunkGetFloat();
+        return;
+    }
+
+    // each float is a 16-bit exponent followed by a 32-bit mantissa
+    const uint8_t *src = ReadChunkSpan(count * 6);
+
+    if (!src)
+        return;
+
+    for (int i = 0; i < count; i++, src += 6)
+    {
+        int exp  = (src[0] | (src[1] << 8)) - 256;
+        int mant = (int)(src[2] | (src[3] << 8) | (src[4] << 16) | ((uint32_t)src[5] << 24));
+
+        dest[i] = (float)ldexp((float)mant, -30 + exp);
+    }
+}
+
 bool SavePushReadChunk(const char *id)
 {
     SaveChunk *cur;
@@ -341,8 +456,6 @@ bool SavePushReadChunk(const char *id)
     // top level chunk ?
     if (chunk_stack_size == 0)
     {
-        uint32_t i;
-
         uint32_t orig_len;
         uint32_t decomp_len;
 
@@ -353,8 +466,7 @@ bool SavePushReadChunk(const char *id)
 
         uint8_t *file_data = new uint8_t[file_len + 1];
 
-        for (i = 0; (i < file_len) && !last_error; i++)
-            file_data[i] = SaveChunkGetByte();
+        SaveChunkGetBytes(file_data, file_len);
 
         EPI_ASSERT(!last_error);
 
@@ -809,8 +921,7 @@ const char *SaveChunkGetString(void)
     char *result = new char[len + 1];
     result[len]  = 0;
 
-    for (int i = 0; i < len; i++)
-        result[i] = (char)SaveChunkGetByte();
+    SaveChunkGetBytes((uint8_t *)result, len);
 
     return result;
 }
@@ -55,6 +55,13 @@ uint32_t SaveChunkGetInteger(void);
 BAMAngle SaveChunkGetAngle(void);
 float    SaveChunkGetFloat(void);
 
+// bulk readers: these decode `count' consecutive values in one go, which
+// is much faster than repeated single reads for big arrays.
+void SaveChunkGetBytes(uint8_t *dest, int count);
+void SaveChunkSkipBytes(int count);
+void SaveChunkGetIntegerArray(uint32_t *dest, int count);
+void SaveChunkGetFloatArray(float *dest, int count);
+
 const char *SaveChunkGetString(void);
 const char *SaveChunkCopyString(const char *old);
 void        SaveChunkFreeString(const char *str);
@@ -35,6 +35,32 @@
 #include "sv_main.h"
 #include "w_wad.h"
 
+// How a loaded field gets read into the known structure.  The fast
+// methods bypass the per-element get routines and decode the whole run
+// of values with the bulk readers.
+enum SaveFieldLoadMethod
+{
+    kSaveLoadSkip = 0, // field no longer exists
+    kSaveLoadGeneric,  // call the known field's get routine per element
+    kSaveLoadInteger,  // raw 32-bit values (integers, angles)
+    kSaveLoadFloat     // float values (floats and vectors)
+};
+
+struct SaveFieldMap
+{
+    SaveFieldLoadMethod method;
+
+    // offset of the known field in its structure
+    int offset;
+
+    // number of elements read into the structure, any extra elements
+    // in the savegame are skipped.
+    int load_count;
+
+    // number of raw values per element (for the fast methods)
+    int values_per_elem;
+};
+
 static SaveStruct *loaded_struct_list;
 static SaveArray  *loaded_array_list;
 
@@ -114,6 +140,7 @@ static void LoadFreeStruct(SaveStruct *S)
     SaveChunkFreeString(S->marker);
 
     delete[] S->fields;
+    delete[] S->field_map;
 
     delete S;
 }
@@ -167,27 +194,29 @@ static SaveField *StructFindField(SaveStruct *info, const char *name)
     return nullptr;
 }
 
-static void StructSkipField(SaveField *field)
+static void StructSkipFields(SaveField *field, int count)
 {
     char marker[6];
-    int  i;
 
     switch (field->type.kind)
     {
     case kSaveFieldStruct:
-        SaveChunkGetMarker(marker);
-        //!!! compare marker with field->type.name
-        SaveSkipReadChunk(marker);
+        for (; count > 0; count--)
+        {
+            SaveChunkGetMarker(marker);
+            //!!! compare marker with field->type.name
+            SaveSkipReadChunk(marker);
+        }
         break;
 
     case kSaveFieldString:
-        SaveChunkFreeString(SaveChunkGetString());
+        for (; count > 0; count--)
+            SaveChunkFreeString(SaveChunkGetString());
         break;
 
     case kSaveFieldNumeric:
     case kSaveFieldIndex:
-        for (i = 0; i < field->type.size; i++)
-            SaveChunkGetByte();
+        SaveChunkSkipBytes(field->type.size * count);
         break;
 
     default:
@@ -195,6 +224,54 @@ static void StructSkipField(SaveField *field)
     }
 }
 
+//
+// Build the loaded-to-known translation for a single field.  This is
+// done once per STRU chunk, so loading each element of an array is just
+// a walk through the resulting table.
+//
+static void CompileFieldMap(SaveStruct *S, SaveField *F, SaveFieldMap *M)
+{
+    SaveField *actual = F->known_field;
+
+    M->method          = kSaveLoadSkip;
+    M->offset          = 0;
+    M->load_count      = 0;
+    M->values_per_elem = 1;
+
+    // if this field no longer exists, it will be ignored
+    if (!actual)
+        return;
+
+    EPI_ASSERT(actual->field_get);
+    EPI_ASSERT(S->counterpart);
+
+    M->method     = kSaveLoadGeneric;
+    M->offset     = actual->offset_pointer - S->counterpart->dummy_base;
+    M->load_count = HMM_MIN(F->count, actual->count);
+
+    if (F->type.kind != kSaveFieldNumeric || actual->type.kind != kSaveFieldNumeric)
+        return;
+
+    if (F->type.size == 4 && (actual->field_get == SaveGameGetInteger || actual->field_get == SaveGameGetAngle))
+    {
+        M->method = kSaveLoadInteger;
+    }
+    else if (actual->field_get == SaveGameGetFloat)
+    {
+        M->method = kSaveLoadFloat;
+    }
+    else if (actual->field_get == SaveGameGetVec2)
+    {
+        M->method          = kSaveLoadFloat;
+        M->values_per_elem = 2;
+    }
+    else if (actual->field_get == SaveGameGetVec3)
+    {
+        M->method          = kSaveLoadFloat;
+        M->values_per_elem = 3;
+    }
+}
+
 bool SaveGameStructLoad(void *base, SaveStruct *info)
 {
     // the savestruct_t here is the "loaded" one.
@@ -206,45 +283,45 @@ bool SaveGameStructLoad(void *base, SaveStruct *info)
     if (strcmp(marker, info->marker) != 0 || !SavePushReadChunk(marker))
         return false;
 
-    for (SaveField *F = info->fields; F->type.kind != kSaveFieldInvalid; F++)
-    {
-        SaveField *actual = F->known_field;
+    SaveFieldMap *M = info->field_map;
 
+    for (SaveField *F = info->fields; F->type.kind != kSaveFieldInvalid; F++, M++)
+    {
         // if this field no longer exists, ignore it
-        if (!actual)
+        if (M->method == kSaveLoadSkip)
         {
-            for (int i = 0; i < F->count; i++)
-                StructSkipField(F);
+            StructSkipFields(F, F->count);
             continue;
         }
 
-        EPI_ASSERT(actual->field_get);
-        EPI_ASSERT(info->counterpart);
+        char *storage = ((char *)base) + M->offset;
 
-        int offset = actual->offset_pointer - info->counterpart->dummy_base;
+        switch (M->method)
+        {
+        case kSaveLoadInteger:
+            SaveChunkGetIntegerArray((uint32_t *)storage, M->load_count * M->values_per_elem);
+            break;
 
-        char *storage = ((char *)base) + offset;
+        case kSaveLoadFloat:
+            SaveChunkGetFloatArray((float *)storage, M->load_count * M->values_per_elem);
+            break;
 
-        for (int i = 0; i < F->count; i++)
-        {
-            // if there are extra elements in the savegame, ignore them
-            if (i >= actual->count)
-            {
-                StructSkipField(F);
-                continue;
-            }
-            switch (actual->type.kind)
-            {
-            case kSaveFieldStruct:
-            case kSaveFieldIndex:
-                (*actual->field_get)(storage, i, (char *)actual->type.name);
-                break;
-
-            default:
-                (*actual->field_get)(storage, i, nullptr);
-                break;
-            }
+        default: {
+            SaveField *actual = F->known_field;
+            void      *extra  = nullptr;
+
+            if (actual->type.kind == kSaveFieldStruct || actual->type.kind == kSaveFieldIndex)
+                extra = (char *)actual->type.name;
+
+            for (int i = 0; i < M->load_count; i++)
+                (*actual->field_get)(storage, i, extra);
+            break;
+        }
         }
+
+        // if there are extra elements in the savegame, ignore them
+        if (F->count > M->load_count)
+            StructSkipFields(F, F->count - M->load_count);
     }
 
     SavePopReadChunk();
@@ -275,7 +352,8 @@ static bool SV_LoadSTRU(void)
     if (strlen(S->marker) != 4)
         FatalError("LOADGAME: Corrupt savegame (STRU bad marker)\n");
 
-    S->fields = new SaveField[numfields + 1];
+    S->fields    = new SaveField[numfields + 1];
+    S->field_map = new SaveFieldMap[numfields + 1];
 
     EPI_CLEAR_MEMORY(S->fields, SaveField, numfields + 1);
 
@@ -304,6 +382,8 @@ static bool SV_LoadSTRU(void)
             F->known_field = StructFindField(S->counterpart, F->field_name);
 
         // ??? compare names for STRUCT and INDEX
+
+        CompileFieldMap(S, F, &S->field_map[i]);
     }
 
     // terminate the array
@@ -124,6 +124,11 @@ struct SaveStruct
     // known struct of the same name (or nullptr if none).  For known info,
     // this points to the loaded info (or nullptr if absent).
     SaveStruct *counterpart;
+
+    // only used when loading.  For loaded info, this is the precompiled
+    // translation of each loaded field to the known one (parallel to the
+    // `fields' array).  Always nullptr for known info.
+    struct SaveFieldMap *field_map;
 };
 
 // This describes a single array
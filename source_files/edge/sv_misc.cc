@@ -516,6 +516,9 @@ extern std::vector<LightSpecial *> active_lights;
 
 int SV_LightCountElems(void)
 {
+    // only called when saving
+    UpdateLightCounts();
+
     return (int)active_lights.size();
 }
 
@@ -558,7 +561,7 @@ void SV_LightCreateElems(int num_elems)
 
 void SV_LightFinaliseElems(void)
 {
-    // nothing to do
+    ScheduleAllLights();
 }
 
 //----------------------------------------------------------------------------
@@ -687,6 +690,9 @@ extern std::vector<PlaneMover *> active_planes;
 
 int SV_PlaneMoveCountElems(void)
 {
+    // only called when saving
+    WakeAllPlanes();
+
     return (int)active_planes.size();
 }
 
@@ -745,6 +751,9 @@ extern std::vector<SlidingDoorMover *> active_sliders;
 
 int SV_SliderMoveCountElems(void)
 {
+    // only called when saving
+    WakeAllSliders();
+
     return (int)active_sliders.size();
 }
 
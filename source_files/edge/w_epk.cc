@@ -17,9 +17,13 @@
 //----------------------------------------------------------------------------
 
 #include <algorithm>
+#include <list>
+#include <map>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
+#include "con_var.h"
 #include "ddf_colormap.h"
 #include "ddf_main.h"
 #include "epi.h"
@@ -27,6 +31,7 @@
 #include "epi_filesystem.h"
 #include "epi_str_compare.h"
 #include "epi_str_util.h"
+#include "epi_thread.h"
 #include "miniz.h"
 #include "r_image.h"
 #include "script/compat/lua_compat.h"
@@ -36,6 +41,105 @@
 
 static std::string known_image_directories[5] = {"flats", "graphics", "skins", "textures", "sprites"};
 
+// size (in MB) of the cache of fully inflated EPK entries
+EDGE_DEFINE_CONSOLE_VARIABLE(epk_cache_size, "32", kConsoleVariableFlagArchive)
+
+// inflate the compressed EPK entries a level needs on all cores
+EDGE_DEFINE_CONSOLE_VARIABLE(epk_preinflate, "1", kConsoleVariableFlagArchive)
+
+class PackFile;
+
+static void PurgeInflatedEntries(PackFile *pack);
+
+//----------------------------------------------------------------------------
+//  NAME MATCHING
+//----------------------------------------------------------------------------
+
+// Pack lookups ignore case and treat both kinds of slash the same.
+// These work on string_views so that lookups never allocate.
+
+static inline char FoldPackNameChar(char ch)
+{
+    if (ch == '\\')
+        return '/';
+
+    return (char)epi::ToLowerASCII(ch);
+}
+
+static uint32_t HashPackName(std::string_view name)
+{
+    // FNV-1a over the folded characters
+    uint32_t hash = 2166136261u;
+
+    for (char ch : name)
+    {
+        hash ^= (uint8_t)FoldPackNameChar(ch);
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+static bool PackNamesMatch(std::string_view A, std::string_view B)
+{
+    if (A.size() != B.size())
+        return false;
+
+    for (size_t i = 0; i < A.size(); i++)
+        if (FoldPackNameChar(A[i]) != FoldPackNameChar(B[i]))
+            return false;
+
+    return true;
+}
+
+static inline bool IsPackSeparator(char ch)
+{
+    return ch == '/' || ch == '\\';
+}
+
+static std::string_view PackFilenameView(std::string_view path)
+{
+    for (size_t p = path.size(); p > 0; p--)
+        if (IsPackSeparator(path[p - 1]))
+            return path.substr(p);
+
+    return path;
+}
+
+// position of the extension's dot in a filename, or npos.  A leading
+// dot (un*x style hidden file) does not count.
+static size_t PackExtensionPos(std::string_view filename)
+{
+    size_t dot = filename.rfind('.');
+
+    if (dot == std::string_view::npos || dot == 0)
+        return std::string_view::npos;
+
+    return dot;
+}
+
+static std::string_view PackStemView(std::string_view path)
+{
+    std::string_view filename = PackFilenameView(path);
+
+    size_t dot = PackExtensionPos(filename);
+    if (dot != std::string_view::npos)
+        filename.remove_suffix(filename.size() - dot);
+
+    return filename;
+}
+
+static std::string_view PackExtensionView(std::string_view path)
+{
+    std::string_view filename = PackFilenameView(path);
+
+    size_t dot = PackExtensionPos(filename);
+    if (dot == std::string_view::npos)
+        return std::string_view();
+
+    return filename.substr(dot);
+}
+
 class PackEntry
 {
   public:
@@ -114,6 +218,26 @@ class PackDirectory
     }
 };
 
+// Every file in a pack, in the order they were found.  Unlike the
+// directory entries, this includes files in deeper directories.
+class PackPath
+{
+  public:
+    // path relative to pack's "root" directory
+    std::string pack_path_;
+
+    // only for Folder: the full pathname to file (for FileOpen).
+    std::string full_path_;
+
+    // only for ZIP: the index into the archive.
+    mz_uint zip_index_;
+
+    PackPath(const std::string &ppath, const std::string &path, mz_uint idx)
+        : pack_path_(ppath), full_path_(path), zip_index_(idx)
+    {
+    }
+};
+
 class PackFile
 {
   public:
@@ -126,22 +250,43 @@ class PackFile
     // things in deeper directories are not stored.
     std::vector<PackDirectory> directories_;
 
-    // for faster file lookups
-    // stored as filename stems as keys; packpath as values
-    std::unordered_multimap<std::string, std::string> search_files_;
+    // for faster file lookups: hashes of the folded pack path and the
+    // folded filename stem, mapping to indices into paths_.  Hashes can
+    // collide, so names must still be compared.
+    std::vector<PackPath>                     paths_;
+    std::unordered_multimap<uint32_t, size_t> path_index_;
+    std::unordered_multimap<uint32_t, size_t> stem_index_;
 
     mz_zip_archive *archive_;
 
+    // only for ZIP: the memory-mapped archive (nullptr when mapping
+    // failed and miniz reads the file itself).
+    epi::File     *archive_file_;
+    const uint8_t *archive_data_;
+    size_t         archive_size_;
+
+    // only for ZIP: whether miniz could read the central directory
+    bool archive_open_;
+
   public:
     PackFile(DataFile *par, bool folder)
-        : parent_(par), is_folder_(folder), directories_(), archive_(nullptr)
+        : parent_(par), is_folder_(folder), directories_(), archive_(nullptr), archive_file_(nullptr),
+          archive_data_(nullptr), archive_size_(0), archive_open_(false)
     {
     }
 
     ~PackFile()
     {
+        PurgeInflatedEntries(this);
+
         if (archive_ != nullptr)
+        {
+            mz_zip_reader_end(archive_);
             delete archive_;
+        }
+
+        if (archive_file_ != nullptr)
+            delete archive_file_;
     }
 
     size_t AddDirectory(const std::string &name)
@@ -166,20 +311,77 @@ class PackFile
 
     void SortEntries();
 
-    epi::File *OpenEntry(size_t dir, size_t index)
+    void AddPath(const std::string &ppath, const std::string &path, mz_uint idx)
+    {
+        size_t index = paths_.size();
+
+        paths_.push_back(PackPath(ppath, path, idx));
+
+        path_index_.insert({HashPackName(ppath), index});
+        stem_index_.insert({HashPackName(PackStemView(ppath)), index});
+    }
+
+    const PackPath *FindPath(std::string_view ppath) const
+    {
+        auto results = path_index_.equal_range(HashPackName(ppath));
+        for (auto it = results.first; it != results.second; ++it)
+        {
+            const PackPath &P = paths_[it->second];
+            if (PackNamesMatch(P.pack_path_, ppath))
+                return &P;
+        }
+
+        return nullptr; // not found
+    }
+
+    // find a bare filename anywhere in the pack (or only in the root).
+    // Realistically identical filename+extensions wouldn't be in the
+    // same pack, so the first match wins.
+    const PackPath *FindFilename(std::string_view filename, bool root_only) const
+    {
+        auto results = stem_index_.equal_range(HashPackName(PackStemView(filename)));
+        for (auto it = results.first; it != results.second; ++it)
+        {
+            const PackPath &P = paths_[it->second];
+
+            std::string_view P_filename = PackFilenameView(P.pack_path_);
+
+            if (root_only && P_filename.size() != P.pack_path_.size())
+                continue;
+
+            if (PackNamesMatch(P_filename, filename))
+                return &P;
+        }
+
+        return nullptr; // not found
+    }
+
+    int CountStem(std::string_view stem) const
+    {
+        int count = 0;
+
+        auto results = stem_index_.equal_range(HashPackName(stem));
+        for (auto it = results.first; it != results.second; ++it)
+            if (PackNamesMatch(PackStemView(paths_[it->second].pack_path_), stem))
+                count++;
+
+        return count;
+    }
+
+    epi::File *OpenPath(const PackPath &P)
     {
         if (is_folder_)
-            return OpenFolderEntry(dir, index);
+            return OpenFolderPath(P);
         else
-            return OpenZipEntry(dir, index);
+            return OpenZipIndex(P.zip_index_);
     }
 
-    epi::File *OpenEntryByName(const std::string &name)
+    epi::File *OpenEntry(size_t dir, size_t index)
     {
         if (is_folder_)
-            return OpenFolderEntryByName(name);
+            return OpenFolderEntry(dir, index);
         else
-            return OpenZipEntryByName(name);
+            return OpenZipEntry(dir, index);
     }
 
     int EntryLength(size_t dir, size_t index)
@@ -218,17 +420,18 @@ class PackFile
         return data;
     }
 
+    epi::File *OpenZipIndex(mz_uint zip_index);
+
   private:
     epi::File *OpenFolderEntry(size_t dir, size_t index);
     epi::File *OpenZipEntry(size_t dir, size_t index);
 
-    epi::File *OpenFolderEntryByName(const std::string &name);
-    epi::File *OpenZipEntryByName(const std::string &name);
+    epi::File *OpenFolderPath(const PackPath &P);
 };
 
-int FindStemInPack(PackFile *pack, const std::string &name)
+int FindStemInPack(PackFile *pack, std::string_view name)
 {
-    return pack->search_files_.count(name);
+    return pack->CountStem(name);
 }
 
 //----------------------------------------------------------------------------
@@ -317,10 +520,8 @@ static void ProcessSubDirectory(PackFile *pack, std::string &fullpath)
             }
             std::string filename = epi::GetFilename(fsd[i].name);
             std::string packpath = epi::MakePathRelative(pack->parent_->name_, fsd[i].name);
-            std::string stem     = epi::GetStem(filename);
-            epi::StringUpperASCII(stem);
             pack->directories_[d].AddEntry(filename, fsd[i].name, packpath, 0);
-            pack->search_files_.insert({stem, packpath});
+            pack->AddPath(packpath, fsd[i].name, 0);
         }
     }
 }
@@ -356,10 +557,8 @@ static PackFile *ProcessFolder(DataFile *df)
             }
             std::string filename = fsd[i].name;
             std::string packpath = epi::MakePathRelative(df->name_, fsd[i].name);
-            std::string stem     = epi::GetStem(filename);
-            epi::StringUpperASCII(stem);
             pack->directories_[0].AddEntry(filename, fsd[i].name, packpath, 0);
-            pack->search_files_.insert({stem, packpath});
+            pack->AddPath(packpath, fsd[i].name, 0);
         }
     }
 
@@ -379,30 +578,215 @@ epi::File *PackFile::OpenFolderEntry(size_t dir, size_t index)
     return F;
 }
 
-epi::File *PackFile::OpenFolderEntryByName(const std::string &name)
+epi::File *PackFile::OpenFolderPath(const PackPath &P)
+{
+    // NOTE: it is okay here when file has gone away since the dir scan
+    return epi::FileOpen(P.full_path_, epi::kFileAccessRead | epi::kFileAccessBinary);
+}
+
+//----------------------------------------------------------------------------
+//  INFLATED ENTRY CACHE
+//----------------------------------------------------------------------------
+
+// A compressed ZIP entry can only be streamed forwards, so readers which
+// seek backwards (image and sound decoders probing headers) would have
+// to inflate it again from the start.  Instead, the whole entry gets
+// inflated once and kept in a LRU cache bounded by `epk_cache_size'.
+//
+// NOTE: the cache is only ever touched from the main thread.
+
+class InflatedEntry
+{
+  public:
+    PackFile *pack_;
+    mz_uint   zip_index_;
+
+    uint8_t *data_;
+    int      length_;
+
+    // number of open files using this data
+    int users_;
+
+    // false once evicted (or never added), the last user frees it
+    bool cached_;
+
+  public:
+    InflatedEntry(PackFile *pack, mz_uint zip_index, uint8_t *data, int length)
+        : pack_(pack), zip_index_(zip_index), data_(data), length_(length), users_(0), cached_(false)
+    {
+    }
+
+    ~InflatedEntry()
+    {
+        delete[] data_;
+    }
+};
+
+typedef std::pair<PackFile *, mz_uint> InflatedKey;
+
+static std::list<InflatedEntry *>                                  inflated_lru; // most recent first
+static std::map<InflatedKey, std::list<InflatedEntry *>::iterator> inflated_lookup;
+static size_t                                                      inflated_total = 0;
+
+static size_t InflatedCacheBudget(void)
+{
+    if (epk_cache_size.d_ <= 0)
+        return 0;
+
+    return (size_t)epk_cache_size.d_ * 1024 * 1024;
+}
+
+static void EvictInflatedEntry(std::list<InflatedEntry *>::iterator it)
+{
+    InflatedEntry *entry = *it;
+
+    inflated_lookup.erase(InflatedKey(entry->pack_, entry->zip_index_));
+    inflated_lru.erase(it);
+    inflated_total -= entry->length_;
+
+    entry->cached_ = false;
+
+    if (entry->users_ == 0)
+        delete entry;
+}
+
+static void TrimInflatedCache(size_t budget)
+{
+    while (inflated_total > budget && !inflated_lru.empty())
+        EvictInflatedEntry(std::prev(inflated_lru.end()));
+}
+
+// returns nullptr when not cached, otherwise the caller becomes a user
+// and must call ReleaseInflatedEntry() when done.
+static InflatedEntry *FindInflatedEntry(PackFile *pack, mz_uint zip_index)
+{
+    auto found = inflated_lookup.find(InflatedKey(pack, zip_index));
+    if (found == inflated_lookup.end())
+        return nullptr;
+
+    // move to front
+    inflated_lru.splice(inflated_lru.begin(), inflated_lru, found->second);
+
+    InflatedEntry *entry = *found->second;
+    entry->users_ += 1;
+    return entry;
+}
+
+static bool IsEntryInflated(PackFile *pack, mz_uint zip_index)
 {
-    std::string fullpath = parent_->name_;
-    fullpath.push_back('/');
-    fullpath.append(name);
+    return inflated_lookup.find(InflatedKey(pack, zip_index)) != inflated_lookup.end();
+}
+
+// takes ownership of `data' (allocated with new[]).  Entries bigger
+// than the whole budget are never cached, they simply live as long as
+// their users.
+static InflatedEntry *AddInflatedEntry(PackFile *pack, mz_uint zip_index, uint8_t *data, int length)
+{
+    EPI_ASSERT(!IsEntryInflated(pack, zip_index));
+
+    InflatedEntry *entry = new InflatedEntry(pack, zip_index, data, length);
+
+    size_t budget = InflatedCacheBudget();
+
+    if ((size_t)length > budget)
+        return entry;
+
+    TrimInflatedCache(budget - length);
+
+    inflated_lru.push_front(entry);
+    inflated_lookup[InflatedKey(pack, zip_index)] = inflated_lru.begin();
+    inflated_total += length;
+
+    entry->cached_ = true;
+    return entry;
+}
+
+static void ReleaseInflatedEntry(InflatedEntry *entry)
+{
+    EPI_ASSERT(entry->users_ > 0);
 
-    // NOTE: it is okay here when file does not exist
-    return epi::FileOpen(fullpath, epi::kFileAccessRead | epi::kFileAccessBinary);
+    entry->users_ -= 1;
+
+    if (entry->users_ == 0 && !entry->cached_)
+        delete entry;
+}
+
+static void PurgeInflatedEntries(PackFile *pack)
+{
+    for (auto it = inflated_lru.begin(); it != inflated_lru.end();)
+    {
+        auto next = std::next(it);
+
+        if ((*it)->pack_ == pack)
+            EvictInflatedEntry(it);
+
+        it = next;
+    }
 }
 
 //----------------------------------------------------------------------------
 //  ZIP READING
 //----------------------------------------------------------------------------
 
-static PackFile *ProcessZip(DataFile *df)
+// Maps the archive and reads its central directory.  This touches no
+// global state (errors are reported later by ProcessZip), so the startup
+// code runs it for many packs at once on worker threads.
+static void OpenPackArchive(PackFile *pack)
 {
-    PackFile *pack = new PackFile(df, false);
-
     pack->archive_ = new mz_zip_archive;
 
     // this is necessary (but stupid)
     memset(pack->archive_, 0, sizeof(mz_zip_archive));
 
-    if (!mz_zip_reader_init_file(pack->archive_, df->name_.c_str(), 0))
+    // prefer a memory-mapped archive: stored entries can then be read
+    // in place, and compressed ones inflated from any thread.
+    pack->archive_file_ = epi::FileOpenMapped(pack->parent_->name_);
+
+    if (pack->archive_file_ != nullptr && pack->archive_file_->GetData() != nullptr)
+    {
+        pack->archive_data_ = pack->archive_file_->GetData();
+        pack->archive_size_ = (size_t)pack->archive_file_->GetLength();
+    }
+    else if (pack->archive_file_ != nullptr)
+    {
+        delete pack->archive_file_;
+        pack->archive_file_ = nullptr;
+    }
+
+    if (pack->archive_data_ != nullptr)
+        pack->archive_open_ = mz_zip_reader_init_mem(pack->archive_, pack->archive_data_, pack->archive_size_, 0);
+    else
+        pack->archive_open_ = mz_zip_reader_init_file(pack->archive_, pack->parent_->name_.c_str(), 0);
+}
+
+void PrefetchPack(DataFile *df)
+{
+    if (df->pack_ != nullptr)
+        return;
+
+    // folders are cheap to scan, and scanning them logs warnings
+    if (df->kind_ != kFileKindEPK && df->kind_ != kFileKindEEPK && df->kind_ != kFileKindIPK)
+        return;
+
+    PackFile *pack = new PackFile(df, false);
+
+    OpenPackArchive(pack);
+
+    df->pack_ = pack;
+}
+
+static PackFile *ProcessZip(DataFile *df)
+{
+    // the startup code may have opened it already
+    PackFile *pack = df->pack_;
+
+    if (pack == nullptr)
+    {
+        pack = new PackFile(df, false);
+        OpenPackArchive(pack);
+    }
+
+    if (!pack->archive_open_)
     {
         switch (mz_zip_get_last_error(pack->archive_))
         {
@@ -462,15 +846,45 @@ static PackFile *ProcessZip(DataFile *df)
             dir_idx = pack->AddDirectory(filename);
         }
         std::string add_name = basename;
-        std::string stem     = epi::GetStem(basename);
-        epi::StringUpperASCII(stem);
         pack->directories_[dir_idx].AddEntry(epi::GetFilename(add_name), "", packpath, idx);
-        pack->search_files_.insert({stem, packpath});
+        pack->AddPath(packpath, "", idx);
     }
 
     return pack;
 }
 
+// Find the raw (possibly compressed) data of an entry inside a
+// memory-mapped archive, or nullptr if not mapped or the local header
+// looks bogus.
+static const uint8_t *LocateRawEntryData(PackFile *pack, const mz_zip_archive_file_stat &stat)
+{
+    if (pack->archive_data_ == nullptr)
+        return nullptr;
+
+    const size_t kLocalHeaderSize = 30;
+
+    size_t offset = (size_t)stat.m_local_header_ofs;
+
+    if (offset + kLocalHeaderSize > pack->archive_size_)
+        return nullptr;
+
+    const uint8_t *header = pack->archive_data_ + offset;
+
+    uint32_t signature = header[0] | (header[1] << 8) | (header[2] << 16) | ((uint32_t)header[3] << 24);
+    if (signature != 0x04034b50)
+        return nullptr;
+
+    size_t name_len  = header[26] | (header[27] << 8);
+    size_t extra_len = header[28] | (header[29] << 8);
+
+    offset += kLocalHeaderSize + name_len + extra_len;
+
+    if (offset + (size_t)stat.m_comp_size > pack->archive_size_)
+        return nullptr;
+
+    return pack->archive_data_ + offset;
+}
+
 class ZIPFile : public epi::File
 {
   private:
@@ -483,22 +897,27 @@ class ZIPFile : public epi::File
 
     mz_zip_reader_extract_iter_state *iter = nullptr;
 
+    // the whole entry, once it has been inflated
+    InflatedEntry *inflated = nullptr;
+
   public:
-    ZIPFile(PackFile *_pack, mz_uint _idx) : pack(_pack), zip_idx(_idx)
+    ZIPFile(PackFile *_pack, mz_uint _idx, mz_uint _length, InflatedEntry *_inflated)
+        : pack(_pack), zip_idx(_idx), length(_length), inflated(_inflated)
     {
-        // determine length
-        mz_zip_archive_file_stat stat;
-        if (mz_zip_reader_file_stat(pack->archive_, zip_idx, &stat))
-            length = (mz_uint)stat.m_uncomp_size;
-
-        iter = mz_zip_reader_extract_iter_new(pack->archive_, zip_idx, 0);
-        EPI_ASSERT(iter);
+        if (inflated == nullptr)
+        {
+            iter = mz_zip_reader_extract_iter_new(pack->archive_, zip_idx, 0);
+            EPI_ASSERT(iter);
+        }
     }
 
     ~ZIPFile()
     {
         if (iter != nullptr)
             mz_zip_reader_extract_iter_free(iter);
+
+        if (inflated != nullptr)
+            ReleaseInflatedEntry(inflated);
     }
 
     int GetLength()
@@ -520,6 +939,13 @@ class ZIPFile : public epi::File
         if (count > length - pos)
             count = length - pos;
 
+        if (inflated != nullptr)
+        {
+            memcpy(dest, inflated->data_ + pos, count);
+            pos += count;
+            return count;
+        }
+
         size_t got = mz_zip_reader_extract_iter_read(iter, dest, count);
 
         pos += got;
@@ -568,12 +994,19 @@ class ZIPFile : public epi::File
             return true;
         }
 
-        // to go backwards, we are forced to rewind to beginning
-        if (want_pos < pos)
+        // to go backwards, inflate the whole entry (once) so that any
+        // further seeking is free.  Only rewind as a last resort.
+        if (want_pos < pos && inflated == nullptr && !InflateWhole())
         {
             Rewind();
         }
 
+        if (inflated != nullptr)
+        {
+            pos = want_pos;
+            return true;
+        }
+
         // trivial success when already there
         if (want_pos == pos)
             return true;
@@ -582,7 +1015,46 @@ class ZIPFile : public epi::File
         return true;
     }
 
+    const uint8_t *GetData()
+    {
+        if (inflated != nullptr)
+            return inflated->data_;
+
+        return nullptr;
+    }
+
   private:
+    bool InflateWhole()
+    {
+        uint8_t *data = new uint8_t[length + 1];
+
+        if (!mz_zip_reader_extract_to_mem(pack->archive_, zip_idx, data, length, 0))
+        {
+            delete[] data;
+            return false;
+        }
+
+        data[length] = 0;
+
+        // another file may have cached it meanwhile
+        inflated = FindInflatedEntry(pack, zip_idx);
+
+        if (inflated != nullptr)
+        {
+            delete[] data;
+        }
+        else
+        {
+            inflated = AddInflatedEntry(pack, zip_idx, data, (int)length);
+            inflated->users_ += 1;
+        }
+
+        mz_zip_reader_extract_iter_free(iter);
+        iter = nullptr;
+
+        return true;
+    }
+
     void Rewind()
     {
         mz_zip_reader_extract_iter_free(iter);
@@ -611,21 +1083,29 @@ class ZIPFile : public epi::File
     }
 };
 
-epi::File *PackFile::OpenZipEntry(size_t dir, size_t index)
+epi::File *PackFile::OpenZipIndex(mz_uint zip_index)
 {
-    ZIPFile *F = new ZIPFile(this, directories_[dir].entries_[index].zip_index_);
-    return F;
+    mz_zip_archive_file_stat stat;
+    if (!mz_zip_reader_file_stat(archive_, zip_index, &stat))
+        return nullptr;
+
+    // stored entries are read straight out of the mapped archive
+    if (stat.m_method == 0 && !stat.m_is_encrypted && stat.m_comp_size == stat.m_uncomp_size &&
+        stat.m_uncomp_size > 0)
+    {
+        const uint8_t *raw = LocateRawEntryData(this, stat);
+        if (raw != nullptr)
+            return new epi::MemFile(raw, (int)stat.m_uncomp_size, false);
+    }
+
+    InflatedEntry *inflated = FindInflatedEntry(this, zip_index);
+
+    return new ZIPFile(this, zip_index, (mz_uint)stat.m_uncomp_size, inflated);
 }
 
-epi::File *PackFile::OpenZipEntryByName(const std::string &name)
+epi::File *PackFile::OpenZipEntry(size_t dir, size_t index)
 {
-    // this ignores case by default
-    int idx = mz_zip_reader_locate_file(archive_, name.c_str(), nullptr, 0);
-    if (idx < 0)
-        return nullptr;
-
-    ZIPFile *F = new ZIPFile(this, (mz_uint)idx);
-    return F;
+    return OpenZipIndex(directories_[dir].entries_[index].zip_index_);
 }
 
 //----------------------------------------------------------------------------
@@ -936,155 +1416,62 @@ void ProcessHiresPackSubstitutions(PackFile *pack, int pack_index)
     }
 }
 
-bool FindPackFile(PackFile *pack, const std::string &name)
+// Finds a file in the pack from a name as given to OpenPackFile:
+// either a path relative to the pack's root, a bare filename to be
+// found anywhere, or a '/' followed by a filename which must be in
+// the root directory.  Returns nullptr when not present.
+static const PackPath *ResolvePackName(PackFile *pack, std::string_view name)
 {
-    // when file does not exist, this returns false.
-
     EPI_ASSERT(!name.empty());
 
     // disallow absolute (real filesystem) paths,
     // although we have to let a leading '/' slide to be caught later
     if (epi::IsPathAbsolute(name) && name[0] != '/')
-        return false;
+        return nullptr;
 
     // disallow path traversal with ..
-    if (name.find("..") != std::string::npos)
-        return false;
+    if (name.find("..") != std::string_view::npos)
+        return nullptr;
 
     // do not accept filenames without extensions
-    if (epi::GetExtension(name).empty())
-        return false;
+    if (PackExtensionView(name).empty())
+        return nullptr;
 
-    // Make a copy in case we need to pop a leading slash
-    std::string find_name = name;
+    std::string_view find_name = name;
 
     bool root_only = false;
 
     // Check for root-only search
     if (name[0] == '/')
     {
-        find_name = name.substr(1);
-        if (find_name == epi::GetFilename(name))
+        find_name.remove_prefix(1);
+        if (PackFilenameView(find_name).size() == find_name.size())
             root_only = true;
     }
 
-    std::string find_stem = epi::GetStem(name);
-    epi::StringUpperASCII(find_stem);
+    // Specific path given; find it as-is
+    if (PackFilenameView(find_name).size() != find_name.size())
+        return pack->FindPath(find_name);
 
-    // quick file stem check to see if it's present at all
-    if (!FindStemInPack(pack, find_stem))
-        return false;
+    return pack->FindFilename(find_name, root_only);
+}
 
-    // Specific path given; attempt to find as-is, otherwise return false
-    if (find_name != epi::GetFilename(find_name))
-    {
-        std::string find_comp = find_name;
-        auto        results   = pack->search_files_.equal_range(find_stem);
-        for (auto file = results.first; file != results.second; ++file)
-        {
-            if (find_comp == file->second)
-                return true;
-        }
-        return false;
-    }
-    // Search only the root dir for this filename, return false if not present
-    else if (root_only)
-    {
-        for (auto file : pack->directories_[0].entries_)
-        {
-            if (epi::StringCaseCompareASCII(file.name_, find_name) == 0)
-                return true;
-        }
-        return false;
-    }
-    // Only filename given; return first full match from search list, if present
-    // Search list is unordered, but realistically identical filename+extensions
-    // wouldn't be in the same pack
-    else
-    {
-        auto results = pack->search_files_.equal_range(find_stem);
-        for (auto file = results.first; file != results.second; ++file)
-        {
-            if (epi::StringCaseCompareASCII(find_name, epi::GetFilename(file->second)) == 0)
-                return true;
-        }
-        return false;
-    }
+bool FindPackFile(PackFile *pack, const std::string &name)
+{
+    // when file does not exist, this returns false.
 
-    // Fallback
-    return false;
+    return ResolvePackName(pack, name) != nullptr;
 }
 
 epi::File *OpenPackFile(PackFile *pack, const std::string &name)
 {
     // when file does not exist, this returns nullptr.
 
-    EPI_ASSERT(!name.empty());
-
-    // disallow absolute (real filesystem) paths,
-    // although we have to let a leading '/' slide to be caught later
-    if (epi::IsPathAbsolute(name) && name[0] != '/')
-        return nullptr;
-
-    // disallow path traversal with ..
-    if (name.find("..") != std::string::npos)
-        return nullptr;
-
-    // do not accept filenames without extensions
-    if (epi::GetExtension(name).empty())
-        return nullptr;
-
-    // Make a copy in case we need to pop a leading slash
-    std::string open_name = name;
-
-    bool root_only = false;
-
-    // Check for root-only search
-    if (name[0] == '/')
-    {
-        open_name = name.substr(1);
-        if (epi::GetDirectory(open_name).empty())
-            root_only = true;
-    }
-
-    std::string open_stem = epi::GetStem(open_name);
-    epi::StringUpperASCII(open_stem);
-
-    // quick file stem check to see if it's present at all
-    if (!FindStemInPack(pack, open_stem))
-        return nullptr;
-
-    // Specific path given; attempt to open as-is, otherwise return nullptr
-    if (open_name != epi::GetFilename(open_name))
-    {
-        return pack->OpenEntryByName(open_name);
-    }
-    // Search only the root dir for this filename, return nullptr if not present
-    else if (root_only)
-    {
-        for (auto file : pack->directories_[0].entries_)
-        {
-            if (epi::StringCaseCompareASCII(file.pack_path_, open_name) == 0)
-                return pack->OpenEntryByName(open_name);
-        }
-        return nullptr;
-    }
-    // Only filename given; return first full match from search list, if present
-    // Search list is unordered, but realistically identical filename+extensions
-    // wouldn't be in the same pack
-    else
-    {
-        auto results = pack->search_files_.equal_range(open_stem);
-        for (auto file = results.first; file != results.second; ++file)
-        {
-            if (epi::StringCaseCompareASCII(open_name, epi::GetFilename(file->second)) == 0)
-                return pack->OpenEntryByName(file->second);
-        }
+    const PackPath *P = ResolvePackName(pack, name);
+    if (P == nullptr)
         return nullptr;
-    }
 
-    // Fallback
-    return nullptr;
+    return pack->OpenPath(*P);
 }
 
 // Like the above, but is in the form of a stem + acceptable extensions
@@ -1096,23 +1483,20 @@ epi::File *OpenPackMatch(PackFile *pack, const std::string &name, const std::vec
     if (extensions.empty())
         return nullptr;
 
-    std::string open_stem = name;
-    epi::StringUpperASCII(open_stem);
+    auto results = pack->stem_index_.equal_range(HashPackName(name));
+    for (auto file = results.first; file != results.second; ++file)
+    {
+        const PackPath &P = pack->paths_[file->second];
 
-    // quick file stem check to see if it's present at all
-    if (!FindStemInPack(pack, open_stem))
-        return nullptr;
+        if (!PackNamesMatch(PackStemView(P.pack_path_), name))
+            continue;
 
-    std::string stem_match = open_stem;
+        std::string_view ext = PackExtensionView(P.pack_path_);
 
-    auto results = pack->search_files_.equal_range(open_stem);
-    for (auto file = results.first; file != results.second; ++file)
-    {
-        for (auto ext : extensions)
+        for (const std::string &match : extensions)
         {
-            epi::ReplaceExtension(stem_match, ext);
-            if (epi::StringCaseCompareASCII(stem_match, epi::GetFilename(file->second)) == 0)
-                return pack->OpenEntryByName(file->second);
+            if (PackNamesMatch(ext, match))
+                return pack->OpenPath(P);
         }
     }
 
@@ -1161,6 +1545,112 @@ std::vector<std::string> GetPackSpriteList(PackFile *pack)
     return found_sprites;
 }
 
+struct PreinflateJob
+{
+    mz_uint zip_index;
+
+    const uint8_t *raw;
+    size_t         raw_length;
+    mz_uint32      crc32;
+
+    uint8_t *data;
+    size_t   length;
+    bool     ok;
+};
+
+static void PreinflateWorker(int index, void *userdata)
+{
+    PreinflateJob *job = (PreinflateJob *)userdata + index;
+
+    size_t got = tinfl_decompress_mem_to_mem(job->data, job->length, job->raw, job->raw_length, 0);
+
+    job->ok = (got == job->length) && mz_crc32(MZ_CRC32_INIT, job->data, job->length) == job->crc32;
+}
+
+void PreinflatePackEntries(PackFile *pack, const std::vector<std::string> &names)
+{
+    // inflating straight from the mapped archive is what makes this
+    // thread-safe: miniz itself is never called from the workers.
+    if (!epk_preinflate.d_ || pack->is_folder_ || pack->archive_data_ == nullptr)
+        return;
+
+    size_t budget = InflatedCacheBudget();
+    size_t total  = 0;
+
+    std::vector<PreinflateJob> jobs;
+
+    for (const std::string &name : names)
+    {
+        const PackPath *P = ResolvePackName(pack, name);
+        if (P == nullptr)
+            continue;
+
+        mz_uint idx = P->zip_index_;
+        if (IsEntryInflated(pack, idx))
+            continue;
+
+        mz_zip_archive_file_stat stat;
+        if (!mz_zip_reader_file_stat(pack->archive_, idx, &stat))
+            continue;
+
+        // stored entries are already usable in place
+        if (stat.m_method != MZ_DEFLATED || stat.m_is_encrypted || stat.m_uncomp_size == 0)
+            continue;
+
+        if (total + (size_t)stat.m_uncomp_size > budget)
+            continue;
+
+        const uint8_t *raw = LocateRawEntryData(pack, stat);
+        if (raw == nullptr)
+            continue;
+
+        bool duplicate = false;
+        for (const PreinflateJob &job : jobs)
+            if (job.zip_index == idx)
+                duplicate = true;
+
+        if (duplicate)
+            continue;
+
+        PreinflateJob job;
+
+        job.zip_index  = idx;
+        job.raw        = raw;
+        job.raw_length = (size_t)stat.m_comp_size;
+        job.crc32      = stat.m_crc32;
+        job.length     = (size_t)stat.m_uncomp_size;
+        job.data       = new uint8_t[job.length + 1];
+        job.ok         = false;
+
+        job.data[job.length] = 0;
+
+        jobs.push_back(job);
+        total += job.length;
+    }
+
+    if (jobs.empty())
+        return;
+
+    epi::ParallelFor((int)jobs.size(), PreinflateWorker, jobs.data());
+
+    for (PreinflateJob &job : jobs)
+    {
+        if (!job.ok)
+        {
+            LogWarning("Failed to inflate entry %u of %s\n", job.zip_index, pack->parent_->name_.c_str());
+            delete[] job.data;
+            continue;
+        }
+
+        InflatedEntry *entry = AddInflatedEntry(pack, job.zip_index, job.data, (int)job.length);
+
+        if (!entry->cached_)
+            delete entry;
+    }
+
+    LogDebug("Pre-inflated %d entries of %s\n", (int)jobs.size(), pack->parent_->name_.c_str());
+}
+
 static void ProcessWADsInPack(PackFile *pack)
 {
     for (size_t d = 0; d < pack->directories_.size(); d++)
@@ -27,12 +27,16 @@ epi::File *OpenPackFile(PackFile *pack, const std::string &name);
 epi::File *OpenPackMatch(PackFile *pack, const std::string &name, const std::vector<std::string> &extensions);
 
 // Equivalent to IsLumpInPwad....doesn't care or check filetype itself
-int FindStemInPack(PackFile *pack, const std::string &name);
+int FindStemInPack(PackFile *pack, std::string_view name);
 
 // Checks if exact filename is found in a pack; used to help load order
 // determination
 bool FindPackFile(PackFile *pack, const std::string &name);
 
+// Inflate the given (compressed) pack entries in parallel and keep them
+// in the inflated entry cache, so that opening them later is cheap.
+void PreinflatePackEntries(PackFile *pack, const std::vector<std::string> &names);
+
 // Check images/sound/etc that may override WAD-oriented lumps or definitions
 void ProcessPackSubstitutions(PackFile *pack, int pack_index);
 
@@ -43,6 +47,10 @@ void ProcessHiresPackSubstitutions(PackFile *pack, int pack_index);
 // InitializeSprites
 std::vector<std::string> GetPackSpriteList(PackFile *pack);
 
+// Map an EPK and read its central directory, ahead of ProcessAllInPack.
+// Safe to call from a worker thread.
+void PrefetchPack(DataFile *df);
+
 // Only populate the pack directory; used for ad-hoc folder/EPK checks
 void PopulatePackOnly(DataFile *df);
 
@@ -43,6 +43,7 @@
 #include "epi.h"
 #include "epi_file.h"
 #include "epi_filesystem.h"
+#include "epi_thread.h"
 #include "i_system.h"
 #include "rad_trig.h"
 #include "w_epk.h"
@@ -91,7 +92,8 @@ size_t AddPendingFile(std::string file, FileKind kind)
 }
 
 // TODO tidy this
-extern void ProcessWad(DataFile *df, size_t file_index);
+extern void        ProcessWad(DataFile *df, size_t file_index);
+extern void        PrefetchWad(DataFile *df);
 
 extern std::string BuildXGLNodesForWAD(DataFile *df);
 
@@ -154,15 +156,16 @@ void ProcessFile(DataFile *df)
 
     if (df->kind_ <= kFileKindXWAD)
     {
-        epi::File *file = epi::FileOpen(filename, epi::kFileAccessRead | epi::kFileAccessBinary);
-        if (file == nullptr)
+        // may have been opened by PrefetchDataFiles already
+        if (df->file_ == nullptr)
+            df->file_ = epi::FileOpenMapped(filename);
+
+        if (df->file_ == nullptr)
         {
             FatalError("Couldn't open file: %s\n", filename.c_str());
             return;
         }
 
-        df->file_ = file;
-
         ProcessWad(df, file_index);
     }
     else if (df->kind_ == kFileKindPackWAD || df->kind_ == kFileKindIPackWAD)
@@ -188,6 +191,46 @@ void ProcessFile(DataFile *df)
     }
 }
 
+//----------------------------------------------------------------------------
+//  PARALLEL PREFETCH
+//----------------------------------------------------------------------------
+
+// The slow, self-contained part of loading each WAD/EPK (mapping it,
+// reading its directory, hashing it) runs for all files at once on the
+// worker threads.  ProcessFile() then adds the lumps and scans the
+// contents in the usual load order, so the end result is the same.
+
+static void PrefetchWorker(int index, void *userdata)
+{
+    DataFile *df = ((DataFile **)userdata)[index];
+
+    if (df->kind_ <= kFileKindXWAD)
+        PrefetchWad(df);
+    else
+        PrefetchPack(df);
+}
+
+static void PrefetchDataFiles(const std::vector<DataFile *> &files)
+{
+    std::vector<DataFile *> jobs;
+
+    for (DataFile *df : files)
+    {
+        if (df->kind_ <= kFileKindXWAD || df->kind_ == kFileKindEPK || df->kind_ == kFileKindEEPK ||
+            df->kind_ == kFileKindIPK)
+        {
+            jobs.push_back(df);
+        }
+    }
+
+    if (jobs.empty())
+        return;
+
+    epi::ParallelFor((int)jobs.size(), PrefetchWorker, jobs.data());
+}
+
+//----------------------------------------------------------------------------
+
 void ProcessMultipleFiles()
 {
     // open all the files, add all the lumps.
@@ -197,6 +240,8 @@ void ProcessMultipleFiles()
     std::vector<DataFile *> copied_files(data_files);
     data_files.clear();
 
+    PrefetchDataFiles(copied_files);
+
     for (size_t i = 0; i < copied_files.size(); i++)
     {
         ProcessFile(copied_files[i]);
@@ -268,6 +313,44 @@ epi::File *OpenFileFromPack(const std::string &name)
     return nullptr;
 }
 
+void PreinflatePackFiles(const std::vector<std::string> &names)
+{
+    if (names.empty())
+        return;
+
+    // each name belongs to the newest pack containing it, the same one
+    // OpenFileFromPack() will use.
+    std::vector<bool> claimed(names.size(), false);
+
+    for (int i = (int)data_files.size() - 1; i >= 0; i--)
+    {
+        DataFile *df = data_files[i];
+        if (df->kind_ == kFileKindEPK || df->kind_ == kFileKindEEPK || df->kind_ == kFileKindIPK)
+        {
+            std::vector<std::string> pack_names;
+
+            for (size_t k = 0; k < names.size(); k++)
+            {
+                if (!claimed[k] && FindPackFile(df->pack_, names[k]))
+                {
+                    claimed[k] = true;
+                    pack_names.push_back(names[k]);
+                }
+            }
+
+            if (!pack_names.empty())
+                PreinflatePackEntries(df->pack_, pack_names);
+        }
+        else if (df->kind_ == kFileKindFolder || df->kind_ == kFileKindEFolder || df->kind_ == kFileKindIFolder)
+        {
+            // folders win over older packs, but have nothing to inflate
+            for (size_t k = 0; k < names.size(); k++)
+                if (!claimed[k] && FindPackFile(df->pack_, names[k]))
+                    claimed[k] = true;
+        }
+    }
+}
+
 //----------------------------------------------------------------------------
 
 uint8_t *OpenPackOrLumpInMemory(const std::string &name, const std::vector<std::string> &extensions, int *length)
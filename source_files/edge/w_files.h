@@ -88,6 +88,10 @@ void   ProcessFile(DataFile *df);
 
 epi::File *OpenFileFromPack(const std::string &name);
 
+// warm the EPK caches for files which are about to be opened with
+// OpenFileFromPack().  Purely an optimisation.
+void PreinflatePackFiles(const std::vector<std::string> &names);
+
 void DoPackSubstitutions(void);
 
 uint8_t *OpenPackOrLumpInMemory(const std::string &name, const std::vector<std::string> &extensions, int *length);
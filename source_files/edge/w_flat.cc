@@ -443,6 +443,8 @@ static void PrecacheTextures(void)
     EDGE_QSORT(const Image *, images, count, 10);
 #undef EDGE_CMP
 
+    ImagePreinflate(images, count);
+
     for (int i = 0; i < count; i++)
     {
         EPI_ASSERT(images[i]);
@@ -740,6 +740,10 @@ void PrecacheSprites(void)
         sprite_present[mo->state_->sprite] = 1;
     }
 
+    // collect the images first, so their pack entries can be
+    // inflated in one go before caching them.
+    std::vector<const Image *> images;
+
     for (int i = 1; i < sprite_count; i++) // ignore 0
     {
         SpriteDefinition *def = sprites[i];
@@ -773,7 +777,7 @@ void PrecacheSprites(void)
                 if (cur_image == nullptr || cur_image == last_image)
                     continue;
 
-                ImagePrecache(cur_image);
+                images.push_back(cur_image);
 
                 last_image = cur_image;
             }
@@ -781,6 +785,11 @@ void PrecacheSprites(void)
     }
 
     delete[] sprite_present;
+
+    ImagePreinflate(images.data(), (int)images.size());
+
+    for (const Image *image : images)
+        ImagePrecache(image);
 }
 
 //--- editor settings ---
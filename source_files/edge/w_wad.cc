@@ -116,11 +116,17 @@ class WadFile
 
     std::string md5_string_;
 
+    // raw directory, from PrefetchWad() until ProcessWad() is done with it
+    std::vector<RawWadEntry> directory_;
+    bool                     directory_read_;
+    bool                     bad_magic_;
+
   public:
     WadFile()
         : sprite_lumps_(), flat_lumps_(), patch_lumps_(), colormap_lumps_(), tx_lumps_(), hires_lumps_(), xgl_lumps_(),
           level_markers_(), skin_markers_(), wadtex_(), lua_huds_(-1),
-          umapinfo_lump_(-1), animated_(-1), switches_(-1), md5_string_()
+          umapinfo_lump_(-1), animated_(-1), switches_(-1), md5_string_(), directory_(), directory_read_(false),
+          bad_magic_(false)
     {
         for (int d = 0; d < kTotalDDFTypes; d++)
             ddf_lumps_[d] = -1;
@@ -946,22 +952,18 @@ static void ProcessBoomStuffInWad(DataFile *df)
     {
         LogPrint("Loading ANIMATED from: %s\n", df->name_.c_str());
 
-        int      length = -1;
-        uint8_t *data   = LoadLumpIntoMemory(animated, &length);
+        LumpView data(animated);
 
-        DDFConvertAnimatedLump(data, length);
-        delete[] data;
+        DDFConvertAnimatedLump(data.GetData(), data.GetSize());
     }
 
     if (switches >= 0)
     {
         LogPrint("Loading SWITCHES from: %s\n", df->name_.c_str());
 
-        int      length = -1;
-        uint8_t *data   = LoadLumpIntoMemory(switches, &length);
+        LumpView data(switches);
 
-        DDFConvertSwitchesLump(data, length);
-        delete[] data;
+        DDFConvertSwitchesLump(data.GetData(), data.GetSize());
     }
 
     // handle BOOM Colourmaps (between C_START and C_END)
@@ -971,47 +973,86 @@ static void ProcessBoomStuffInWad(DataFile *df)
     }
 }
 
-void ProcessWad(DataFile *df, size_t file_index)
+//
+// Opens a WAD (when not open already), reads its directory and hashes
+// it.  This touches no global state, so the startup code runs it for
+// many files at once on worker threads.  Failures are left for
+// ProcessWad to report.
+//
+void PrefetchWad(DataFile *df)
 {
-    WadFile *wad = new WadFile();
-    df->wad_     = wad;
+    if (df->wad_ == nullptr)
+        df->wad_ = new WadFile();
 
-    // reset the sprite/flat/patch list stuff
-    within_sprite_list = within_flat_list = false;
-    within_patch_list = within_colmap_list = false;
-    within_tex_list = within_hires_list = false;
-    within_xgl_list                     = false;
+    WadFile *wad = df->wad_;
 
-    RawWadHeader header;
+    if (wad->directory_read_)
+        return;
+
+    if (df->file_ == nullptr)
+        df->file_ = epi::FileOpenMapped(df->name_);
 
     epi::File *file = df->file_;
 
+    if (file == nullptr)
+        return;
+
+    RawWadHeader header;
+
     // TODO: handle Read failure
     file->Read(&header, sizeof(RawWadHeader));
 
-    if (strncmp(header.magic, "IWAD", 4) != 0)
+    if (strncmp(header.magic, "IWAD", 4) != 0 && strncmp(header.magic, "PWAD", 4) != 0)
     {
-        // Homebrew levels?
-        if (strncmp(header.magic, "PWAD", 4) != 0)
-        {
-            FatalError("Wad file %s doesn't have IWAD or PWAD id\n", df->name_.c_str());
-        }
+        wad->bad_magic_ = true;
+        return;
     }
 
     header.total_entries   = AlignedLittleEndianS32(header.total_entries);
     header.directory_start = AlignedLittleEndianS32(header.directory_start);
 
-    size_t length = header.total_entries * sizeof(RawWadEntry);
+    wad->directory_.resize(header.total_entries);
 
-    RawWadEntry *raw_info = new RawWadEntry[header.total_entries];
+    size_t length = header.total_entries * sizeof(RawWadEntry);
 
     file->Seek(header.directory_start, epi::File::kSeekpointStart);
     // TODO: handle Read failure
-    file->Read(raw_info, length);
+    file->Read(wad->directory_.data(), length);
+
+    // compute MD5 hash over wad directory
+    epi::MD5Hash dir_md5;
+    dir_md5.Compute((const uint8_t *)wad->directory_.data(), length);
+
+    wad->md5_string_ = dir_md5.ToString();
+
+    wad->directory_read_ = true;
+}
+
+void ProcessWad(DataFile *df, size_t file_index)
+{
+    // nothing happens when the startup code already did this
+    PrefetchWad(df);
+
+    WadFile *wad = df->wad_;
+
+    if (wad->bad_magic_)
+    {
+        // Homebrew levels?
+        FatalError("Wad file %s doesn't have IWAD or PWAD id\n", df->name_.c_str());
+    }
+
+    // reset the sprite/flat/patch list stuff
+    within_sprite_list = within_flat_list = false;
+    within_patch_list = within_colmap_list = false;
+    within_tex_list = within_hires_list = false;
+    within_xgl_list                     = false;
+
+    RawWadEntry *raw_info      = wad->directory_.data();
+    size_t       total_entries = wad->directory_.size();
 
     int startlump = (int)lump_info.size();
 
-    for (size_t i = 0; i < header.total_entries; i++)
+    for (size_t i = 0; i < total_entries; i++)
     {
         RawWadEntry &entry = raw_info[i];
 
@@ -1024,7 +1065,7 @@ void ProcessWad(DataFile *df, size_t file_index)
         // this will be uppercase
         const char *level_name = lump_info[startlump + i].name;
 
-        CheckForLevel(wad, startlump + i, level_name, &entry, header.total_entries - 1 - i);
+        CheckForLevel(wad, startlump + i, level_name, &entry, total_entries - 1 - i);
     }
 
     // check for unclosed sprite/flat/patch lists
@@ -1048,15 +1089,10 @@ void ProcessWad(DataFile *df, size_t file_index)
 
     SortSpriteLumps(wad);
 
-    // compute MD5 hash over wad directory
-    epi::MD5Hash dir_md5;
-    dir_md5.Compute((const uint8_t *)raw_info, length);
-
-    wad->md5_string_ = dir_md5.ToString();
-
     LogDebug("   md5hash = %s\n", wad->md5_string_.c_str());
 
-    delete[] raw_info;
+    // not needed anymore
+    std::vector<RawWadEntry>().swap(wad->directory_);
 
     ProcessBoomStuffInWad(df);
     ProcessDDFInWad(df);
@@ -2057,6 +2093,33 @@ int GetKindForLump(int lump)
     return lump_info[lump].kind;
 }
 
+//
+// Returns where the lump lives when its file is resident in memory,
+// otherwise nullptr.  A lump running past the end of the file is as
+// fatal as a short read.
+//
+static const uint8_t *W_MappedLumpData(int lump)
+{
+    LumpInfo *L  = &lump_info[lump];
+    DataFile *df = data_files[L->file];
+
+    const uint8_t *mapped = df->file_->GetData();
+
+    if (mapped == nullptr)
+        return nullptr;
+
+    int length = df->file_->GetLength();
+
+    if (L->position < 0 || L->size < 0 || L->position > length || L->size > length - L->position)
+    {
+        int available = (L->position >= 0 && L->position < length) ? length - L->position : 0;
+
+        FatalError("W_ReadLump: only read %i of %i on lump %i", available, L->size, lump);
+    }
+
+    return mapped + L->position;
+}
+
 //
 // Loads the lump into the given buffer,
 // which must be >= GetLumpLength().
@@ -2069,6 +2132,14 @@ static void W_RawReadLump(int lump, void *dest)
     LumpInfo *L  = &lump_info[lump];
     DataFile *df = data_files[L->file];
 
+    const uint8_t *mapped = W_MappedLumpData(lump);
+
+    if (mapped != nullptr)
+    {
+        memcpy(dest, mapped, L->size);
+        return;
+    }
+
     df->file_->Seek(L->position, epi::File::kSeekpointStart);
 
     int c = df->file_->Read(dest, L->size);
@@ -2106,15 +2177,9 @@ uint8_t *LoadLumpIntoMemory(const char *name, int *length)
 
 std::string LoadLumpAsString(int lump)
 {
-    // WISH: optimise this to remove temporary buffer
-    int      length;
-    uint8_t *data = LoadLumpIntoMemory(lump, &length);
-
-    std::string result((char *)data, length);
-
-    delete[] data;
+    LumpView view(lump);
 
-    return result;
+    return std::string(view.GetString());
 }
 
 std::string LoadLumpAsString(const char *name)
@@ -2122,6 +2187,36 @@ std::string LoadLumpAsString(const char *name)
     return LoadLumpAsString(GetLumpNumberForName(name));
 }
 
+LumpView::LumpView(int lump) : data_(nullptr), size_(0), owned_(nullptr)
+{
+    if (!IsLumpIndexValid(lump))
+        FatalError("LumpView: %i >= numlumps", lump);
+
+    size_ = lump_info[lump].size;
+
+    const uint8_t *mapped = W_MappedLumpData(lump);
+
+    // consumers cast lump data to on-disk structures, so only hand out
+    // a direct pointer when it is suitably aligned for them.
+    if (mapped != nullptr && ((uintptr_t)mapped & 3) == 0)
+    {
+        data_ = mapped;
+        return;
+    }
+
+    owned_ = LoadLumpIntoMemory(lump);
+    data_  = owned_;
+}
+
+LumpView::LumpView(const char *name) : LumpView(GetLumpNumberForName(name))
+{
+}
+
+LumpView::~LumpView()
+{
+    delete[] owned_;
+}
+
 //
 // GetLumpNameFromIndex
 //
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <string_view>
 #include <vector>
 
 #include "dm_defs.h"
@@ -74,6 +75,40 @@ uint8_t *LoadLumpIntoMemory(const char *name, int *length = nullptr);
 std::string LoadLumpAsString(int lump);
 std::string LoadLumpAsString(const char *name);
 
+// Read-only view of a lump's contents.  When the containing file is
+// resident in memory (memory-mapped WADs, WADs inside packs) this points
+// straight into it and nothing is copied, otherwise the lump is loaded
+// into a private buffer which is freed along with the view.  In both
+// cases the data is NOT guaranteed to be NUL terminated.
+class LumpView
+{
+  private:
+    const uint8_t *data_;
+    int            size_;
+    uint8_t       *owned_;
+
+  public:
+    LumpView(int lump);
+    LumpView(const char *name);
+    ~LumpView();
+
+    LumpView(const LumpView &)            = delete;
+    LumpView &operator=(const LumpView &) = delete;
+
+    const uint8_t *GetData() const
+    {
+        return data_;
+    }
+    int GetSize() const
+    {
+        return size_;
+    }
+    std::string_view GetString() const
+    {
+        return std::string_view((const char *)data_, size_);
+    }
+};
+
 bool        IsLumpIndexValid(int lump);
 bool        VerifyLump(int lump, const char *name);
 const char *GetLumpNameFromIndex(int lump);
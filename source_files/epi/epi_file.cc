@@ -22,6 +22,10 @@
 
 #include "HandmadeMath.h"
 #include "epi.h"
+#include "epi_windows.h"
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
 namespace epi
 {
 
@@ -211,6 +215,16 @@ bool SubFile::Seek(int offset, int seekpoint)
     return true;
 }
 
+const uint8_t *SubFile::GetData()
+{
+    const uint8_t *parent_data = parent_->GetData();
+
+    if (parent_data == nullptr)
+        return nullptr;
+
+    return parent_data + start_;
+}
+
 unsigned int SubFile::Write(const void *src, unsigned int size)
 {
     (void)src;
@@ -323,6 +337,84 @@ unsigned int MemFile::Write(const void *src, unsigned int size)
     return 0; /* read only, cobber */
 }
 
+MappedFile::MappedFile(const uint8_t *block, int len) : data_(block), length_(len), pos_(0)
+{
+    EPI_ASSERT(block);
+    EPI_ASSERT(len > 0);
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+    UnmapViewOfFile(data_);
+#else
+    munmap((void *)data_, length_);
+#endif
+    data_   = nullptr;
+    length_ = 0;
+}
+
+unsigned int MappedFile::Read(void *dest, unsigned int size)
+{
+    EPI_ASSERT(dest);
+
+    unsigned int avail = length_ - pos_;
+
+    if (size > avail)
+        size = avail;
+
+    if (size == 0)
+        return 0; // EOF
+
+    memcpy(dest, data_ + pos_, size);
+    pos_ += size;
+
+    return size;
+}
+
+bool MappedFile::Seek(int offset, int seekpoint)
+{
+    int new_pos = 0;
+
+    switch (seekpoint)
+    {
+    case kSeekpointStart: {
+        new_pos = 0;
+        break;
+    }
+    case kSeekpointCurrent: {
+        new_pos = pos_;
+        break;
+    }
+    case kSeekpointEnd: {
+        new_pos = length_;
+        break;
+    }
+
+    default:
+        return false;
+    }
+
+    new_pos += offset;
+
+    // Note: allow position at the very end (last byte + 1).
+    if (new_pos < 0 || new_pos > length_)
+        return false;
+
+    pos_ = new_pos;
+    return true;
+}
+
+unsigned int MappedFile::Write(const void *src, unsigned int size)
+{
+    (void)src;
+    (void)size;
+
+    FatalError("MappedFile::Write called.\n");
+
+    return 0; /* read only, cobber */
+}
+
 } // namespace epi
 
 //--- editor settings ---
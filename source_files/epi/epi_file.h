@@ -55,6 +55,14 @@ class File
 
     virtual bool Seek(int offset, int seekpoint) = 0;
 
+    // returns a pointer to the whole contents when they are already
+    // resident in memory (memory files, memory-mapped files), otherwise
+    // nullptr.  The pointer stays valid for the lifetime of the object.
+    virtual const uint8_t *GetData()
+    {
+        return nullptr;
+    }
+
   public:
     // load the file into memory, reading from the current
     // position, and reading no more than the 'max_size'
@@ -113,6 +121,8 @@ class SubFile : public File
     unsigned int Write(const void *src, unsigned int size);
 
     bool Seek(int offset, int seekpoint);
+
+    const uint8_t *GetData();
 };
 
 class MemFile : public File
@@ -141,6 +151,45 @@ class MemFile : public File
     unsigned int Write(const void *src, unsigned int size);
 
     bool Seek(int offset, int seekpoint);
+
+    const uint8_t *GetData()
+    {
+        return data_;
+    }
+};
+
+// read-only file which has been mapped into memory by the OS.
+// Created by FileOpenMapped(), never directly.
+class MappedFile : public File
+{
+  private:
+    const uint8_t *data_;
+
+    int length_;
+    int pos_;
+
+  public:
+    MappedFile(const uint8_t *block, int len);
+    ~MappedFile();
+
+    int GetLength()
+    {
+        return length_;
+    }
+    int GetPosition()
+    {
+        return pos_;
+    }
+
+    unsigned int Read(void *dest, unsigned int size);
+    unsigned int Write(const void *src, unsigned int size);
+
+    bool Seek(int offset, int seekpoint);
+
+    const uint8_t *GetData()
+    {
+        return data_;
+    }
 };
 
 } // namespace epi
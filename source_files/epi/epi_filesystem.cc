@@ -28,7 +28,9 @@
 #endif
 #ifndef _WIN32
 #include <dirent.h>
+#include <fcntl.h>
 #include <ftw.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -102,6 +104,32 @@ FILE *FileOpenRaw(std::string_view name, unsigned int flags)
     std::wstring wname = epi::UTF8ToWString(name);
     return _wfopen(wname.c_str(), mode);
 }
+File *FileOpenMapped(std::string_view name)
+{
+    EPI_ASSERT(!name.empty());
+    std::wstring wname = epi::UTF8ToWString(name);
+    HANDLE file_handle =
+        CreateFileW(wname.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_handle != INVALID_HANDLE_VALUE)
+    {
+        const void   *data = nullptr;
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(file_handle, &size) && size.QuadPart > 0 && size.QuadPart < INT_MAX)
+        {
+            // the view keeps the mapping alive, so the handles can be closed straight away
+            HANDLE map_handle = CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (map_handle)
+            {
+                data = MapViewOfFile(map_handle, FILE_MAP_READ, 0, 0, 0);
+                CloseHandle(map_handle);
+            }
+        }
+        CloseHandle(file_handle);
+        if (data)
+            return new MappedFile((const uint8_t *)data, (int)size.QuadPart);
+    }
+    return FileOpen(name, kFileAccessRead | kFileAccessBinary);
+}
 bool FileDelete(std::string_view name)
 {
     EPI_ASSERT(!name.empty());
@@ -314,6 +342,25 @@ FILE *FileOpenRaw(std::string_view name, unsigned int flags)
     EPI_ASSERT(!name.empty());
     return fopen(std::string(name).c_str(), mode);
 }
+File *FileOpenMapped(std::string_view name)
+{
+    EPI_ASSERT(!name.empty());
+#ifndef EDGE_WEB
+    int fd = open(std::string(name).c_str(), O_RDONLY);
+    if (fd >= 0)
+    {
+        void       *data = MAP_FAILED;
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0 && info.st_size < INT_MAX)
+            data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        // the mapping stays valid after the descriptor is closed
+        close(fd);
+        if (data != MAP_FAILED)
+            return new MappedFile((const uint8_t *)data, (int)info.st_size);
+    }
+#endif
+    return FileOpen(name, kFileAccessRead | kFileAccessBinary);
+}
 bool FileDelete(std::string_view name)
 {
     EPI_ASSERT(!name.empty());
@@ -70,6 +70,9 @@ bool  FileExists(std::string_view name);
 bool  TestFileAccess(std::string_view name);
 File *FileOpen(std::string_view name, unsigned int flags);
 FILE *FileOpenRaw(std::string_view name, unsigned int flags);
+// Opens a file read-only, memory-mapping it when the platform allows
+// (falls back to a normal binary FileOpen otherwise).
+File *FileOpenMapped(std::string_view name);
 // NOTE: there's no CloseFile function, just delete the object.
 bool FileCopy(std::string_view src, std::string_view dest);
 bool FileDelete(std::string_view name);
@@ -0,0 +1,225 @@
+//----------------------------------------------------------------------------
+//  EDGE Worker Thread Pool
+//----------------------------------------------------------------------------
+//
+//  Copyright (c) 2024 The EDGE Team.
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation; either version 3
+//  of the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//----------------------------------------------------------------------------
+
+#include "epi_thread.h"
+
+#include <vector>
+
+#include "epi.h"
+#include "epi_sdl.h"
+
+namespace epi
+{
+
+static constexpr int kMaximumWorkers = 31;
+
+struct ParallelBatch
+{
+    ParallelJob job;
+    void       *userdata;
+    int         count;
+
+    // next index to hand out, and number of finished jobs
+    SDL_AtomicInt next;
+    SDL_AtomicInt finished;
+
+    // workers currently running jobs from this batch (protected by the
+    // pool mutex).  The batch lives on the caller's stack, so the caller
+    // must wait for this to reach zero before returning.
+    int active_workers;
+};
+
+static std::vector<SDL_Thread *> pool_threads;
+
+static SDL_Mutex     *pool_mutex     = nullptr;
+static SDL_Condition *pool_work_cond = nullptr;
+static SDL_Condition *pool_done_cond = nullptr;
+
+static ParallelBatch *pool_batch      = nullptr;
+static int            pool_generation = 0;
+static bool           pool_quit       = false;
+
+// set while a batch is in flight; claimed with compare-and-swap so that
+// nested or concurrent calls fall back to running serially.
+static SDL_AtomicInt pool_busy;
+
+static void RunBatch(ParallelBatch *batch)
+{
+    for (;;)
+    {
+        int index = SDL_AddAtomicInt(&batch->next, 1);
+
+        if (index >= batch->count)
+            break;
+
+        (*batch->job)(index, batch->userdata);
+
+        SDL_AddAtomicInt(&batch->finished, 1);
+    }
+}
+
+static int WorkerThread(void *data)
+{
+    (void)data;
+
+    int seen_generation = 0;
+
+    SDL_LockMutex(pool_mutex);
+
+    for (;;)
+    {
+        while (!pool_quit && (pool_batch == nullptr || seen_generation == pool_generation))
+            SDL_WaitCondition(pool_work_cond, pool_mutex);
+
+        if (pool_quit)
+            break;
+
+        seen_generation = pool_generation;
+
+        ParallelBatch *batch = pool_batch;
+        batch->active_workers++;
+
+        SDL_UnlockMutex(pool_mutex);
+
+        RunBatch(batch);
+
+        SDL_LockMutex(pool_mutex);
+
+        batch->active_workers--;
+        SDL_BroadcastCondition(pool_done_cond);
+    }
+
+    SDL_UnlockMutex(pool_mutex);
+
+    return 0;
+}
+
+void ThreadPoolStart(int workers)
+{
+    if (pool_mutex != nullptr)
+        return;
+
+#ifdef EDGE_WEB
+    workers = 0;
+#endif
+
+    if (workers < 0)
+        workers = SDL_GetNumLogicalCPUCores() - 1;
+
+    if (workers > kMaximumWorkers)
+        workers = kMaximumWorkers;
+
+    pool_mutex     = SDL_CreateMutex();
+    pool_work_cond = SDL_CreateCondition();
+    pool_done_cond = SDL_CreateCondition();
+    pool_quit      = false;
+
+    for (int i = 0; i < workers; i++)
+    {
+        SDL_Thread *thread = SDL_CreateThread(WorkerThread, "edge_worker", nullptr);
+
+        if (thread == nullptr)
+        {
+            LogWarning("ThreadPoolStart: could not create worker thread: %s\n", SDL_GetError());
+            break;
+        }
+
+        pool_threads.push_back(thread);
+    }
+
+    LogDebug("ThreadPoolStart: %d worker threads\n", (int)pool_threads.size());
+}
+
+void ThreadPoolStop(void)
+{
+    if (pool_mutex == nullptr)
+        return;
+
+    SDL_LockMutex(pool_mutex);
+    pool_quit = true;
+    SDL_BroadcastCondition(pool_work_cond);
+    SDL_UnlockMutex(pool_mutex);
+
+    for (SDL_Thread *thread : pool_threads)
+        SDL_WaitThread(thread, nullptr);
+
+    pool_threads.clear();
+
+    SDL_DestroyCondition(pool_done_cond);
+    SDL_DestroyCondition(pool_work_cond);
+    SDL_DestroyMutex(pool_mutex);
+
+    pool_mutex     = nullptr;
+    pool_work_cond = nullptr;
+    pool_done_cond = nullptr;
+}
+
+int ThreadPoolWorkers(void)
+{
+    return (int)pool_threads.size();
+}
+
+void ParallelFor(int count, ParallelJob job, void *userdata)
+{
+    if (count <= 0)
+        return;
+
+    // run serially when there is nobody to help, for single jobs, and
+    // for nested calls from within a job.
+    if (pool_threads.empty() || count == 1 || !SDL_CompareAndSwapAtomicInt(&pool_busy, 0, 1))
+    {
+        for (int i = 0; i < count; i++)
+            (*job)(i, userdata);
+        return;
+    }
+
+    ParallelBatch batch;
+
+    batch.job            = job;
+    batch.userdata       = userdata;
+    batch.count          = count;
+    batch.active_workers = 0;
+
+    SDL_SetAtomicInt(&batch.next, 0);
+    SDL_SetAtomicInt(&batch.finished, 0);
+
+    SDL_LockMutex(pool_mutex);
+    pool_batch = &batch;
+    pool_generation++;
+    SDL_BroadcastCondition(pool_work_cond);
+    SDL_UnlockMutex(pool_mutex);
+
+    // the calling thread does its share too
+    RunBatch(&batch);
+
+    SDL_LockMutex(pool_mutex);
+
+    while (SDL_GetAtomicInt(&batch.finished) < count || batch.active_workers > 0)
+        SDL_WaitCondition(pool_done_cond, pool_mutex);
+
+    pool_batch = nullptr;
+
+    SDL_UnlockMutex(pool_mutex);
+
+    SDL_SetAtomicInt(&pool_busy, 0);
+}
+
+} // namespace epi
+
+//--- editor settings ---
+// vi:ts=4:sw=4:noexpandtab
@@ -0,0 +1,51 @@
+//----------------------------------------------------------------------------
+//  EDGE Worker Thread Pool
+//----------------------------------------------------------------------------
+//
+//  Copyright (c) 2024 The EDGE Team.
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation; either version 3
+//  of the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//----------------------------------------------------------------------------
+//
+//  A small pool of worker threads for splitting CPU-heavy loops into
+//  independent jobs.  It is always safe to use: when the pool has no
+//  workers (web builds, single core machines, `-threads 0`) every job
+//  simply runs on the calling thread.
+//
+
+#pragma once
+
+namespace epi
+{
+
+// a single job.  `index' is in the range [0, count) of the ParallelFor
+// call, `userdata' is passed through untouched.
+typedef void (*ParallelJob)(int index, void *userdata);
+
+// Starts the worker threads.  A negative count means "one less than
+// the number of logical CPU cores".  Safe to call more than once.
+void ThreadPoolStart(int workers = -1);
+void ThreadPoolStop(void);
+
+// number of worker threads (not counting the main thread)
+int ThreadPoolWorkers(void);
+
+// Runs job(index) for every index in [0, count), spreading the calls
+// over the worker threads and the calling thread, and returns once
+// all of them have finished.  Jobs may run in any order and must not
+// call ParallelFor themselves (nested calls run serially).
+void ParallelFor(int count, ParallelJob job, void *userdata);
+
+} // namespace epi
+
+//--- editor settings ---
+// vi:ts=4:sw=4:noexpandtab